@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LP5817 indicator backend: color writes go through the rgb-indicator driver
+ * under the HX bus lock, and the shadow/status/read-back hooks ride along in
+ * the same bus hold.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(backend_lp5817, LOG_LEVEL_INF);
+
+#include <rgb_indicator.h>
+#include "indicator_backend.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+#include "hx_init.h"
+#include "lp5817_engine.h"
+#include "lp5817_regs.h"
+#include "lp5817_shadow.h"
+#include "lp5817_status.h"
+#include "lp5817_verify.h"
+
+#define RGBCTRL_NODE DT_NODELABEL(rgbctrl)
+
+static const struct device *const rgbi = DEVICE_DT_GET(RGBCTRL_NODE);
+static const struct i2c_dt_spec lp5817 = I2C_DT_SPEC_GET(RGBCTRL_NODE);
+static const uint8_t color_map[LP5817_CHANNELS] = DT_PROP(RGBCTRL_NODE, color_mapping);
+static const uint8_t dc_full[LP5817_CHANNELS] = DT_PROP(RGBCTRL_NODE, dot_current);
+
+/* Dot current kept on every lit output when dimming, below this steps get coarse */
+#define DC_MIN_COUNTS 16
+
+
+static int write_color(void *arg)
+{
+    struct led_rgb color = lp5817_status_remap(arg);
+    int ret = lp5817_engine_stop(NULL);                 // a solid color ends any hardware blink
+
+    if (ret == 0)
+    {
+        ret = rgbi_set_color(rgbi, &color);
+    }
+
+    if (ret == 0)
+    {
+        lp5817_shadow_set_color(&color);
+        lp5817_status_after_write();                    // same bus hold, no extra lock round trip
+        lp5817_verify_after_write();
+    }
+    return ret;
+}
+
+
+int lp5817_backend_set_color(const struct led_rgb *color)
+{
+    static bool up;
+
+    if (!up)
+    {
+        if (hx_init_wait(rgbi, K_FOREVER) != 0)     // deferred init still programming the chip
+        {
+            return -ENODEV;
+        }
+        up = true;
+    }
+    return hx_bus_run(HX_CLIENT_INDICATOR, hx_mux_channel(HX_CLIENT_INDICATOR), write_color, (void *)color);
+}
+
+
+int lp5817_backend_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+#if defined(CONFIG_LP5817_ENGINE)
+    struct lp5817_blink blink = {
+        .color = *color,
+        .on_ms = MIN(on_ms, LP5817_ENGINE_MAX_MS),
+        .off_ms = MIN(off_ms, LP5817_ENGINE_MAX_MS),
+    };
+
+    return hx_bus_run(HX_CLIENT_INDICATOR, hx_mux_channel(HX_CLIENT_INDICATOR), lp5817_engine_blink, &blink);
+#else
+    ARG_UNUSED(color);
+    ARG_UNUSED(on_ms);
+    ARG_UNUSED(off_ms);
+    return -ENOTSUP;
+#endif
+}
+
+
+/* Chip was not power cycled and still shows the color, -ESTALE otherwise */
+static int read_held(void *arg)
+{
+    const struct led_rgb *color = arg;
+    const uint8_t want[LP5817_CHANNELS] = { color->r, color->g, color->b };
+    uint8_t pwm[LP5817_CHANNELS];
+    uint8_t flag;
+
+    if (i2c_reg_read_byte_dt(&lp5817, LP5817_REG_FLAG, &flag) != 0 ||
+        i2c_burst_read_dt(&lp5817, LP5817_REG_OUT0_PWM, pwm, sizeof(pwm)) != 0)
+    {
+        return -EIO;
+    }
+    if ((flag & LP5817_FLAG_POR) != 0)
+    {
+        return -ESTALE;
+    }
+    for (size_t i = 0; i < LP5817_CHANNELS; i++)
+    {
+        if (pwm[color_map[i]] != want[i])
+        {
+            return -ESTALE;
+        }
+    }
+    return 0;
+}
+
+
+bool lp5817_backend_holds(const struct led_rgb *color)
+{
+    struct led_rgb held = lp5817_status_remap(color);
+
+    if (hx_bus_run(HX_CLIENT_INDICATOR, hx_mux_channel(HX_CLIENT_INDICATOR), read_held, &held) != 0)
+    {
+        return false;
+    }
+    lp5817_shadow_set_color(&held);
+    return true;
+}
+
+
+static int write_dc(void *arg)
+{
+    const uint8_t *dc = arg;
+    int ret = i2c_burst_write_dt(&lp5817, LP5817_REG_OUT0_DC, dc, LP5817_CHANNELS);
+
+    if (ret == 0)
+    {
+        lp5817_shadow_set_dc(dc);
+    }
+    return ret;
+}
+
+
+int lp5817_backend_dim(uint16_t scale)
+{
+    uint8_t dc[LP5817_CHANNELS];
+
+    if (!lp5817_backend_ready())
+    {
+        return -EAGAIN;                                 // deferred init would put the DT dot current back
+    }
+    for (size_t i = 0; i < LP5817_CHANNELS; i++)
+    {
+        dc[i] = (uint8_t)((dc_full[i] * (uint32_t)scale + 128) >> 8);
+    }
+    return hx_bus_run(HX_CLIENT_INDICATOR, hx_mux_channel(HX_CLIENT_INDICATOR), write_dc, dc);
+}
+
+
+uint16_t lp5817_backend_dim_min(void)
+{
+    uint8_t lowest = UINT8_MAX;
+
+    for (size_t i = 0; i < LP5817_CHANNELS; i++)
+    {
+        if (dc_full[i] != 0)
+        {
+            lowest = MIN(lowest, dc_full[i]);
+        }
+    }
+    return MIN(DIV_ROUND_UP(DC_MIN_COUNTS * 256, lowest), 256);
+}
+
+
+uint32_t lp5817_backend_frame_us(void)
+{
+    return hx_bus_xfer_us(LP5817_COLOR_FRAME_BYTES);
+}
+
+
+bool lp5817_backend_ready(void)
+{
+    return hx_init_ready(rgbi);
+}
+
+
+int lp5817_backend_init(void)
+{
+    if (hx_init_wait(rgbi, K_NO_WAIT) == -ENODEV)   // -EAGAIN: deferred, writes wait for it
+    {
+        LOG_ERR("LP5817 not ready");
+        return -ENODEV;
+    }
+    return 0;
+}
+
+
+#if defined(CONFIG_INDICATOR_BACKEND_PWM)
+const struct indicator_backend indicator_backend_lp5817 = {
+    .name = "lp5817",
+    .init = lp5817_backend_init,
+    .set_color = lp5817_backend_set_color,
+    .frame_us = lp5817_backend_frame_us,
+    .blink = lp5817_backend_blink,
+    .holds = lp5817_backend_holds,
+    .ready = lp5817_backend_ready,
+    .dim = lp5817_backend_dim,
+    .dim_min = lp5817_backend_dim_min,
+};
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * PWM indicator backend for boards without an LP5817 (the nRF9151 DK): the
+ * three channels of a "pwm-leds" node labelled rgbpwm, children red/green/blue,
+ * driven by the nRF hardware PWM so a held color costs no CPU.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/pwm.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(backend_pwm, LOG_LEVEL_INF);
+
+#include "indicator_backend.h"
+
+#define RGBPWM_NODE DT_NODELABEL(rgbpwm)
+
+static const struct pwm_dt_spec channels[] = {
+    PWM_DT_SPEC_GET(DT_CHILD(RGBPWM_NODE, red)),
+    PWM_DT_SPEC_GET(DT_CHILD(RGBPWM_NODE, green)),
+    PWM_DT_SPEC_GET(DT_CHILD(RGBPWM_NODE, blue)),
+};
+
+
+int pwm_backend_set_color(const struct led_rgb *color)
+{
+    const uint8_t level[] = { color->r, color->g, color->b };
+    int ret = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(channels); i++)
+    {
+        uint32_t pulse = (uint32_t)((uint64_t)channels[i].period * level[i] / UINT8_MAX);
+
+        ret |= pwm_set_pulse_dt(&channels[i], pulse);
+    }
+    return ret == 0 ? 0 : -EIO;
+}
+
+
+uint32_t pwm_backend_frame_us(void)
+{
+    return 0;                                           // register writes only, no bus
+}
+
+
+int pwm_backend_init(void)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(channels); i++)
+    {
+        if (!pwm_is_ready_dt(&channels[i]))
+        {
+            LOG_ERR("PWM channel %u not ready", i);
+            return -ENODEV;
+        }
+    }
+    return 0;
+}
+
+
+#if defined(CONFIG_INDICATOR_BACKEND_LP5817)
+const struct indicator_backend indicator_backend_pwm = {
+    .name = "pwm",
+    .init = pwm_backend_init,
+    .set_color = pwm_backend_set_color,
+    .frame_us = pwm_backend_frame_us,
+};
+
+const struct indicator_backend *indicator_backend = &indicator_backend_lp5817;
+
+
+/* LP5817 when it answers, the PWM pins otherwise */
+int indicator_backend_select(void)
+{
+    if (indicator_backend_lp5817.init() == 0)
+    {
+        indicator_backend = &indicator_backend_lp5817;
+        return 0;
+    }
+    indicator_backend = &indicator_backend_pwm;
+    return indicator_backend_pwm.init();
+}
+#endif
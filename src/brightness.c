@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Brightness governor. The output scale is user brightness x night factor x
+ * ambient factor. It is split between the LP5817 dot-current registers, which
+ * scale the outputs in hardware without touching the PWM values, and the
+ * gamma stage every color passes through on its way to the backend, where it
+ * is one multiply on the gamma table entry. Hardware takes as much as it can
+ * while keeping DC_MIN_COUNTS (backend_lp5817.c) of dot current on every
+ * output; only when the LUT share changes is the shown color rewritten. The
+ * night window is only polled while there is one and the time of day is set.
+ * Dot current is refused while the LP5817 is still in deferred init; the LUT
+ * takes the whole scale until a retry finds the chip up.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(brightness, LOG_LEVEL_INF);
+
+#include "brightness.h"
+#include "indicator.h"
+#include "indicator_backend.h"
+#if defined(CONFIG_INDICATOR_PROFILE)
+#include "indicator_profile.h"
+#endif
+
+#define CHECK_PERIOD K_SECONDS(60)
+#define DIM_RETRY    K_MSEC(100)
+
+/* (i / 255)^2.2, Q8.8 */
+static const uint16_t gamma_q8[256] = {
+        0,     0,     2,     4,     7,    11,    17,    24,
+       32,    42,    53,    65,    78,    94,   110,   128,
+      148,   169,   191,   216,   241,   269,   298,   328,
+      360,   394,   430,   467,   506,   547,   589,   633,
+      679,   726,   776,   827,   880,   934,   991,  1049,
+     1109,  1171,  1235,  1300,  1368,  1437,  1508,  1581,
+     1656,  1733,  1812,  1893,  1975,  2060,  2146,  2235,
+     2325,  2417,  2512,  2608,  2706,  2806,  2908,  3013,
+     3119,  3227,  3337,  3450,  3564,  3680,  3798,  3919,
+     4041,  4166,  4292,  4421,  4552,  4685,  4819,  4956,
+     5096,  5237,  5380,  5525,  5673,  5823,  5974,  6128,
+     6284,  6442,  6603,  6765,  6930,  7097,  7266,  7437,
+     7610,  7786,  7963,  8143,  8325,  8509,  8696,  8885,
+     9075,  9268,  9464,  9661,  9861, 10063, 10267, 10474,
+    10682, 10893, 11107, 11322, 11540, 11760, 11982, 12207,
+    12433, 12663, 12894, 13128, 13363, 13602, 13842, 14085,
+    14330, 14578, 14827, 15080, 15334, 15591, 15850, 16111,
+    16375, 16641, 16909, 17180, 17453, 17729, 18006, 18287,
+    18569, 18854, 19141, 19431, 19723, 20017, 20314, 20613,
+    20915, 21218, 21525, 21833, 22144, 22458, 22774, 23092,
+    23413, 23736, 24062, 24390, 24720, 25053, 25388, 25726,
+    26066, 26408, 26753, 27101, 27451, 27803, 28158, 28515,
+    28875, 29237, 29602, 29969, 30338, 30710, 31085, 31462,
+    31841, 32223, 32608, 32995, 33384, 33776, 34170, 34567,
+    34967, 35369, 35773, 36180, 36589, 37001, 37416, 37833,
+    38252, 38674, 39099, 39526, 39956, 40388, 40823, 41260,
+    41700, 42142, 42587, 43034, 43484, 43937, 44392, 44849,
+    45310, 45772, 46238, 46706, 47176, 47649, 48125, 48603,
+    49084, 49567, 50053, 50542, 51033, 51526, 52023, 52522,
+    53023, 53527, 54034, 54543, 55055, 55570, 56087, 56607,
+    57129, 57654, 58182, 58712, 59245, 59780, 60318, 60859,
+    61402, 61948, 62497, 63048, 63602, 64159, 64718, 65280,
+};
+
+static uint16_t lut_scale = BRIGHTNESS_ONE;     // read on every color, written by the governor only
+static uint8_t user_pct = 100;
+static uint8_t night_pct = 100;
+static uint16_t night_start;
+static uint16_t night_end;
+static int32_t ambient_lux = -1;
+static int64_t clock_base_ms = -1;               // uptime at local midnight, < 0 until set
+static struct brightness_stats stats = {
+    .factor = BRIGHTNESS_ONE,
+    .hw_scale = BRIGHTNESS_ONE,
+    .lut_scale = BRIGHTNESS_ONE,
+};
+static bool dim_stale;                          // dot current refused until the chip is up, LUT covers it
+static struct k_work_delayable check_work;
+static K_MUTEX_DEFINE(lock);
+
+
+struct led_rgb brightness_apply(const struct led_rgb *color)
+{
+    uint32_t s = lut_scale;
+    struct led_rgb out = {
+        .r = (gamma_q8[color->r] * s + 0x8000) >> 16,
+        .g = (gamma_q8[color->g] * s + 0x8000) >> 16,
+        .b = (gamma_q8[color->b] * s + 0x8000) >> 16,
+    };
+
+    return out;
+}
+
+
+static bool in_night(void)
+{
+    uint16_t now;
+
+    if (clock_base_ms < 0 || night_start == night_end)
+    {
+        return false;
+    }
+    now = ((k_uptime_get() - clock_base_ms) / MSEC_PER_SEC / 60) % (24 * 60);
+    return night_start < night_end ? (now >= night_start && now < night_end)
+                                   : (now >= night_start || now < night_end);         // window over midnight
+}
+
+
+/* Log-ish ramp: dark room at the floor, full scale from CONFIG_INDICATOR_BRIGHTNESS_FULL_LUX up */
+static uint16_t ambient_factor(void)
+{
+    uint32_t floor = CONFIG_INDICATOR_BRIGHTNESS_AMBIENT_FLOOR_PCT * BRIGHTNESS_ONE / 100;
+
+    if (ambient_lux < 0 || ambient_lux >= CONFIG_INDICATOR_BRIGHTNESS_FULL_LUX)
+    {
+        return BRIGHTNESS_ONE;
+    }
+    return floor + (BRIGHTNESS_ONE - floor) * (uint32_t)ambient_lux / CONFIG_INDICATOR_BRIGHTNESS_FULL_LUX;
+}
+
+
+/* Call with the lock held */
+static void govern(void)
+{
+    uint32_t factor = (uint32_t)user_pct * BRIGHTNESS_ONE / 100;
+    uint32_t hw;
+    uint32_t lut;
+    int ret;
+
+    if (in_night())
+    {
+        factor = factor * night_pct / 100;
+    }
+    factor = factor * ambient_factor() / BRIGHTNESS_ONE;
+    if (factor == stats.factor && !dim_stale)
+    {
+        return;
+    }
+
+    /* dot current takes what it can resolve, the LUT the rest */
+    hw = MAX(factor, indicator_backend_dim_min());
+    ret = hw != stats.hw_scale ? indicator_backend_dim(hw) : 0;
+    dim_stale = ret == -EAGAIN;
+    if (ret != 0)
+    {
+        hw = BRIGHTNESS_ONE;                            // no dot current here (or not yet), all in the LUT
+    }
+    lut = factor == 0 ? 0 : MIN(DIV_ROUND_CLOSEST(factor * BRIGHTNESS_ONE, hw), BRIGHTNESS_ONE);
+
+    stats.changes++;
+    stats.factor = factor;
+    stats.hw_scale = hw;
+    if (lut == stats.lut_scale)
+    {
+        stats.hw_only++;
+        return;
+    }
+    stats.lut_scale = lut;
+    lut_scale = lut;
+    indicator_refresh();                                // re-show the current color through the new LUT
+}
+
+
+/* Call with the lock held: poll for window crossings only when one can happen */
+static void check_update(void)
+{
+    if (dim_stale)
+    {
+        k_work_reschedule(&check_work, DIM_RETRY);     // move the scale to dot current once the chip is up
+    }
+    else if (clock_base_ms >= 0 && night_start != night_end)
+    {
+        k_work_schedule(&check_work, CHECK_PERIOD);
+    }
+    else
+    {
+        (void)k_work_cancel_delayable(&check_work);
+    }
+}
+
+
+void brightness_set_time(uint16_t minute_of_day)
+{
+    k_mutex_lock(&lock, K_FOREVER);
+    clock_base_ms = k_uptime_get() - (int64_t)(minute_of_day % (24 * 60)) * 60 * MSEC_PER_SEC;
+    govern();
+    check_update();
+    k_mutex_unlock(&lock);
+}
+
+
+void brightness_set_ambient(int32_t lux)
+{
+    k_mutex_lock(&lock, K_FOREVER);
+    ambient_lux = lux;
+    govern();
+    check_update();
+    k_mutex_unlock(&lock);
+}
+
+
+void brightness_stats_get(struct brightness_stats *out)
+{
+    k_mutex_lock(&lock, K_FOREVER);
+    *out = stats;
+    k_mutex_unlock(&lock);
+}
+
+
+static void check_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+    k_mutex_lock(&lock, K_FOREVER);
+    govern();                                           // crossing into or out of the night window
+    check_update();
+    k_mutex_unlock(&lock);
+}
+
+
+#if defined(CONFIG_INDICATOR_PROFILE)
+static void profile_changed(const struct indicator_profile *p)
+{
+    k_mutex_lock(&lock, K_FOREVER);
+    user_pct = p->brightness;
+    night_pct = p->night_brightness;
+    night_start = p->night_start_min;
+    night_end = p->night_end_min;
+    govern();
+    check_update();
+    k_mutex_unlock(&lock);
+}
+#endif
+
+
+static int brightness_init(void)
+{
+#if defined(CONFIG_INDICATOR_PROFILE)
+    struct indicator_profile p;
+#endif
+
+    k_work_init_delayable(&check_work, check_handler);  // no window and no clock yet, nothing to poll
+#if defined(CONFIG_INDICATOR_PROFILE)
+    indicator_profile_set_callback(profile_changed);
+    indicator_profile_get(&p);
+    profile_changed(&p);
+#endif
+    return 0;
+}
+
+SYS_INIT(brightness_init, APPLICATION, CONFIG_INDICATOR_CLIENT_INIT_PRIORITY);
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BRIGHTNESS_H_
+#define BRIGHTNESS_H_
+
+#include <stdint.h>
+#include <rgb_indicator.h>
+
+#define BRIGHTNESS_ONE  256         /* Q8 scale of 1.0 */
+
+struct brightness_stats {
+    uint16_t factor;                /* overall output scale, Q8 */
+    uint16_t hw_scale;              /* share taken by the dot-current registers, Q8 */
+    uint16_t lut_scale;             /* share folded into the gamma stage, Q8 */
+    uint32_t changes;
+    uint32_t hw_only;               /* changes absorbed by dot current, no color rewrite */
+};
+
+#if defined(CONFIG_INDICATOR_BRIGHTNESS)
+
+/** Gamma and brightness in one step: one table read and one multiply per channel. */
+struct led_rgb brightness_apply(const struct led_rgb *color);
+
+/** Local time, as minutes after midnight, for the night window. Re-sync as often as convenient. */
+void brightness_set_time(uint16_t minute_of_day);
+
+/** Ambient light in lux, or a negative value when there is no reading. */
+void brightness_set_ambient(int32_t lux);
+
+void brightness_stats_get(struct brightness_stats *stats);
+
+#else
+
+static inline struct led_rgb brightness_apply(const struct led_rgb *color) { return *color; }
+
+#endif /* CONFIG_INDICATOR_BRIGHTNESS */
+
+#endif /* BRIGHTNESS_H_ */
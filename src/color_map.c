@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sensor-to-color stage. Consumes Sensor-1 batches, quantizes the newest
+ * reading into a band from a const table (with hysteresis so a value sitting
+ * on a band edge does not flicker) and only touches the LED when the band
+ * color changes. Colors go through the indicator worker like any other.
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(color_map, LOG_LEVEL_INF);
+
+#include <rgb_indicator.h>
+#include "hx_sensors.h"
+#include "color_map.h"
+#include "indicator.h"
+
+struct color_band {
+    int32_t floor;              /* band applies from this value up to the next band's floor */
+    struct led_rgb color;
+};
+
+#if defined(CONFIG_SENSOR_COLOR_MAP_TEMPERATURE)
+
+#define MAP_HYST CONFIG_SENSOR_COLOR_MAP_TEMP_HYST_MC
+
+static const struct color_band bands[] = {          // milli-degC
+    { INT32_MIN, RGB(0, 0, 100) },          /* blue, below 0C */
+    { 0,         RGB(0, 100, 100) },        /* cyan */
+    { 10000,     RGB(0, 100, 0) },          /* green */
+    { 20000,     RGB(100, 100, 0) },        /* yellow */
+    { 28000,     RGB(100, 40, 0) },         /* orange */
+    { 35000,     RGB(100, 0, 0) },          /* red, 35C and up */
+};
+
+static int32_t map_input(const struct hx_sample *s)
+{
+    return s->temp_mc;
+}
+
+#else /* CONFIG_SENSOR_COLOR_MAP_PRESSURE_TREND */
+
+#define MAP_HYST CONFIG_SENSOR_COLOR_MAP_TREND_HYST_PA
+#define TREND_DEPTH CONFIG_SENSOR_COLOR_MAP_TREND_BATCHES
+
+static const struct color_band bands[] = {          // Pa change over the trend window
+    { INT32_MIN, RGB(100, 0, 0) },          /* falling fast, weather coming */
+    { -200,      RGB(100, 100, 0) },        /* falling */
+    { -50,       RGB(0, 100, 0) },          /* steady */
+    { 50,        RGB(0, 0, 100) },          /* rising */
+};
+
+static int32_t trend_hist[TREND_DEPTH];
+static uint8_t trend_fill;
+static uint8_t trend_head;
+
+static int32_t map_input(const struct hx_sample *s)
+{
+    int32_t oldest = trend_fill < TREND_DEPTH ? trend_hist[0] : trend_hist[trend_head];
+
+    if (trend_fill == 0)
+    {
+        oldest = s->press_pa;
+    }
+    trend_hist[trend_head] = s->press_pa;
+    trend_head = (trend_head + 1) % TREND_DEPTH;
+    if (trend_fill < TREND_DEPTH)
+    {
+        trend_fill++;
+    }
+    return s->press_pa - oldest;
+}
+
+#endif
+
+static struct color_map_stats stats = { .lat_min_us = UINT32_MAX };
+static uint64_t lat_sum_us;
+
+
+/* Step the current band up or down only once the value clears the edge by MAP_HYST */
+static size_t band_select(size_t band, int32_t value)
+{
+    while (band + 1 < ARRAY_SIZE(bands) && value >= bands[band + 1].floor + MAP_HYST)
+    {
+        band++;
+    }
+    while (band > 0 && value < bands[band].floor - MAP_HYST)
+    {
+        band--;
+    }
+    return band;
+}
+
+
+static void latency_record(uint32_t sample_cycles)
+{
+    uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - sample_cycles);
+
+    stats.updates++;
+    lat_sum_us += us;
+    stats.lat_avg_us = (uint32_t)(lat_sum_us / stats.updates);
+    stats.lat_min_us = MIN(stats.lat_min_us, us);
+    stats.lat_max_us = MAX(stats.lat_max_us, us);
+}
+
+
+static void color_map_thread(void *p1, void *p2, void *p3)
+{
+    size_t band = 0;
+    bool shown = false;
+
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    while (1)
+    {
+        struct hx_batch batch;
+        const struct hx_sample *newest;
+        size_t next;
+
+        if (hx_sensors_batch_get(&batch, K_FOREVER) != 0)
+        {
+            continue;
+        }
+        newest = &batch.samples[batch.count - 1];
+        next = band_select(band, map_input(newest));
+
+        if (!shown || bands[next].color.r != bands[band].color.r ||
+            bands[next].color.g != bands[band].color.g ||
+            bands[next].color.b != bands[band].color.b)
+        {
+            indicator_set_color_from(&bands[next].color, newest->cycles);   // through the bus lock, shadow and gamma
+            latency_record(newest->cycles);
+            shown = true;
+            band = next;
+        }
+        else
+        {
+            stats.suppressed++;
+            band = next;
+        }
+        hx_sensors_batch_release(&batch);
+
+        LOG_DBG("batch %u band %u latency avg %u us", batch.seq, band, stats.lat_avg_us);
+    }
+}
+
+K_THREAD_DEFINE(color_map, 1024, color_map_thread, NULL, NULL, NULL, CONFIG_SENSOR_COLOR_MAP_THREAD_PRIORITY, 0, 0);
+
+
+void color_map_stats_get(struct color_map_stats *out)
+{
+    *out = stats;
+}
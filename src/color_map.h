@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef COLOR_MAP_H_
+#define COLOR_MAP_H_
+
+#include <stdint.h>
+
+/*
+ * Sample-to-request latency, from the sample timestamp to the indicator request;
+ * indicator_stats_get() has the time on to the LED.
+ */
+struct color_map_stats {
+    uint32_t updates;           /* colors actually written */
+    uint32_t suppressed;        /* batches that quantized to the color already shown */
+    uint32_t lat_min_us;
+    uint32_t lat_max_us;
+    uint32_t lat_avg_us;
+};
+
+void color_map_stats_get(struct color_map_stats *stats);
+
+#endif /* COLOR_MAP_H_ */
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HX bus speed benchmark. Streams color frames through the real driver path
+ * at each I2C speed the controller accepts and reports frame throughput and
+ * how much of the elapsed time the bus was actually clocking data.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_bench, LOG_LEVEL_INF);
+
+#include <rgb_indicator.h>
+#include "hx_bench.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+#include "indicator.h"
+#include "lp5817_regs.h"
+#include "lp5817_shadow.h"
+
+static const struct device *const rgbi = DEVICE_DT_GET(DT_NODELABEL(rgbctrl));
+
+static const uint32_t rates[] = { I2C_BITRATE_STANDARD, I2C_BITRATE_FAST, I2C_BITRATE_FAST_PLUS };
+
+
+static int bench_frame(void *arg)
+{
+    return rgbi_set_color(rgbi, arg);
+}
+
+
+static void bench_rate(uint32_t frames, struct hx_bench_result *res)
+{
+    static const struct led_rgb frame_colors[] = { RGB(4, 0, 0), RGB(0, 4, 0) };   // dim, it is visible
+    uint8_t chan = hx_mux_channel(HX_CLIENT_INDICATOR);
+    uint32_t start;
+    uint32_t elapsed_us;
+
+    res->status = hx_bus_set_bitrate(res->bitrate);
+    if (res->status != 0)
+    {
+        return;
+    }
+
+    start = k_cycle_get_32();
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        int ret = hx_bus_run(HX_CLIENT_SHELL, chan, bench_frame, (void *)&frame_colors[i & 1]);
+
+        if (ret != 0)
+        {
+            res->status = ret;
+            return;
+        }
+    }
+    elapsed_us = MAX(k_cyc_to_us_floor32(k_cycle_get_32() - start), 1);
+
+    res->frame_us = elapsed_us / frames;
+    res->frames_per_s = (uint32_t)((uint64_t)frames * USEC_PER_SEC / elapsed_us);
+    res->occupancy_pct = (uint32_t)((uint64_t)frames * hx_bus_xfer_us(LP5817_COLOR_FRAME_BYTES) * 100 / elapsed_us);
+}
+
+
+size_t hx_bench_run(uint32_t frames, struct hx_bench_result *results, size_t max)
+{
+    uint32_t configured = hx_bus_bitrate();
+    size_t n = 0;
+
+    if (frames == 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(rates) && n < max; i++, n++)
+    {
+        results[n] = (struct hx_bench_result){ .bitrate = rates[i] };
+        bench_rate(frames, &results[n]);
+        LOG_INF("%7u Hz: %d, %u frames/s, %u us/frame, bus %u%%", results[n].bitrate, results[n].status,
+                results[n].frames_per_s, results[n].frame_us, results[n].occupancy_pct);
+    }
+
+    (void)hx_bus_set_bitrate(configured);
+#if defined(CONFIG_LP5817_SHADOW)
+    (void)hx_bus_run(HX_CLIENT_SHELL, hx_mux_channel(HX_CLIENT_INDICATOR), lp5817_shadow_restore, NULL);
+#endif
+#if defined(CONFIG_INDICATOR)
+    indicator_frame_rate_update();
+#endif
+    return n;
+}
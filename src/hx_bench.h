@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_BENCH_H_
+#define HX_BENCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct hx_bench_result {
+    uint32_t bitrate;
+    int status;                 /* 0, or why the controller would not run at this rate */
+    uint32_t frames_per_s;
+    uint32_t frame_us;          /* measured, per color frame */
+    uint32_t occupancy_pct;     /* wire time / elapsed time while streaming frames */
+};
+
+/**
+ * Stream frames color updates to the LP5817 at each bus speed (standard,
+ * fast, fast-plus), then put the bus and the LED back as they were.
+ *
+ * @return number of results written
+ */
+size_t hx_bench_run(uint32_t frames, struct hx_bench_result *results, size_t max);
+
+#endif /* HX_BENCH_H_ */
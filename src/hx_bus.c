@@ -0,0 +1,607 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HX bus manager. Serializes application traffic on the host extension bus
+ * (the indicator's driver calls plus any direct register work) and owns the
+ * mux channel. Synchronous callers take the bus in hx_bus_run(); deferrable
+ * work is queued and drained by the bus worker one mux channel at a time.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/sys/atomic.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_bus, LOG_LEVEL_INF);
+
+#include "hx_bus.h"
+#include "hx_mux.h"
+
+static K_MUTEX_DEFINE(bus_lock);
+
+K_THREAD_STACK_DEFINE(hx_bus_stack, CONFIG_HX_BUS_STACK_SIZE);
+static struct k_work_q hx_bus_q;
+static struct k_work drain_work;
+static struct k_spinlock queue_lock;
+static sys_slist_t queue;
+
+#define HX_I2C_NODE DT_BUS(DT_NODELABEL(rgbctrl))
+
+static const struct device *const hx_i2c = DEVICE_DT_GET(HX_I2C_NODE);
+static uint32_t bitrate = DT_PROP_OR(HX_I2C_NODE, clock_frequency, I2C_BITRATE_STANDARD);
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+static sys_slist_t restore_hooks;
+static struct hx_bus_fault_stats fault_stats;
+static atomic_t xfer_start;                         // cycle stamp | 1 while the owner's fn runs, 0 otherwise
+#endif
+
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+static struct {
+    int err;
+    uint16_t pending;
+    bool stuck;
+} inject;
+#endif
+
+static const char *const client_names[HX_CLIENT_COUNT] = {
+    [HX_CLIENT_INDICATOR] = "indicator",
+    [HX_CLIENT_SENSORS] = "sensors",
+    [HX_CLIENT_IMU] = "imu",
+    [HX_CLIENT_ENUM] = "enum",
+    [HX_CLIENT_SHELL] = "shell",
+};
+
+#if defined(CONFIG_HX_BUS_TRACE)
+/* Only written with the bus held */
+static struct hx_bus_trace_entry trace[CONFIG_HX_BUS_TRACE_DEPTH];
+static uint16_t trace_armed;
+static uint16_t trace_len;
+static enum hx_client trace_client;
+#endif
+
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+
+/* Only written by the bus owner, the mutex serializes the updates */
+static struct hx_bus_client_stats client_stats[HX_CLIENT_COUNT];
+static enum hx_client owner;
+static uint32_t owned_at;
+
+
+static void hist_add(struct hx_bus_hist *hist, uint32_t cycles)
+{
+    uint32_t us = k_cyc_to_us_floor32(cycles);
+    uint32_t n = us == 0 ? 0 : MIN(31 - __builtin_clz(us), HX_BUS_HIST_BUCKETS - 1);
+
+    hist->bucket[n]++;
+    hist->count++;
+    hist->max_us = MAX(hist->max_us, us);
+}
+
+#endif /* CONFIG_HX_BUS_LOCK_STATS */
+
+
+void hx_bus_lock(enum hx_client client)
+{
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+    uint32_t asked = k_cycle_get_32();
+
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    owned_at = k_cycle_get_32();
+    owner = client;
+    hist_add(&client_stats[client].wait, owned_at - asked);
+#else
+    ARG_UNUSED(client);
+    k_mutex_lock(&bus_lock, K_FOREVER);
+#endif
+#if defined(CONFIG_HX_BUS_TRACE)
+    trace_client = client;
+#endif
+}
+
+
+void hx_bus_unlock(void)
+{
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+    hist_add(&client_stats[owner].hold, k_cycle_get_32() - owned_at);
+#endif
+    k_mutex_unlock(&bus_lock);
+}
+
+
+#if defined(CONFIG_HX_BUS_TRACE)
+static void trace_add(uint32_t start, uint8_t mux_chan, hx_bus_fn_t fn, int ret)
+{
+    struct hx_bus_trace_entry *e;
+
+    if (trace_armed == 0 || trace_len >= ARRAY_SIZE(trace))
+    {
+        return;
+    }
+    e = &trace[trace_len++];
+    trace_armed--;
+    e->at_us = k_cyc_to_us_floor32(start);
+    e->dur_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    e->fn = fn;
+    e->result = ret;
+    e->client = trace_client;
+    e->mux_chan = mux_chan;
+}
+#endif
+
+
+static int run_locked(uint8_t mux_chan, hx_bus_fn_t fn, void *arg)
+{
+    int ret;
+#if defined(CONFIG_HX_BUS_TRACE)
+    uint32_t start = k_cycle_get_32();
+#endif
+
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+    if (inject.pending > 0 || inject.stuck)
+    {
+        inject.pending -= inject.pending > 0;
+        return inject.err;                          // as if the transfer NACKed or timed out
+    }
+#endif
+#if defined(CONFIG_HX_BUS_RECOVERY)
+    atomic_set(&xfer_start, (atomic_val_t)(k_cycle_get_32() | 1));
+#endif
+    ret = hx_mux_select(mux_chan);
+    if (ret == 0)
+    {
+        ret = fn(arg);
+    }
+#if defined(CONFIG_HX_BUS_RECOVERY)
+    atomic_set(&xfer_start, 0);
+#endif
+#if defined(CONFIG_HX_BUS_TRACE)
+    trace_add(start, mux_chan, fn, ret);
+#endif
+    return ret;
+}
+
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+
+static bool bus_fault(int ret)
+{
+    return ret == -EIO || ret == -ETIMEDOUT || ret == -ENXIO;
+}
+
+
+/*
+ * Called with the bus held after a failed transaction. Retries with
+ * exponential backoff, then clears the controller the transaction used (9
+ * clocks + STOP); for the HX bus itself the restore hooks are replayed so
+ * parts that saw a partial write are back in a known state. Then a final
+ * attempt. The bus stays held throughout so nobody else queues traffic onto
+ * a bus in recovery.
+ */
+static int recover(const struct device *bus, uint8_t mux_chan, hx_bus_fn_t fn, void *arg, int ret)
+{
+    uint32_t start = k_cycle_get_32();
+    uint32_t backoff_us = CONFIG_HX_BUS_RETRY_BACKOFF_US;
+    struct hx_bus_restore *hook;
+
+    fault_stats.faults++;
+    for (int attempt = 0; attempt < CONFIG_HX_BUS_RETRIES && bus_fault(ret); attempt++)
+    {
+        k_usleep(backoff_us);
+        backoff_us *= 2;
+        fault_stats.retries++;
+        ret = run_locked(mux_chan, fn, arg);
+    }
+
+    if (bus_fault(ret))
+    {
+        LOG_WRN("%s fault persists (%d), clearing bus", bus->name, ret);
+        if (i2c_recover_bus(bus) != 0)
+        {
+            LOG_WRN("Bus clear not supported or failed");
+        }
+        fault_stats.bus_clears++;
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+        inject.stuck = false;                       // a stuck line is what the clear is for
+#endif
+        if (bus == hx_i2c)
+        {
+            hx_mux_invalidate();
+            SYS_SLIST_FOR_EACH_CONTAINER(&restore_hooks, hook, node)
+            {
+                (void)run_locked(hook->mux_chan, hook->fn, hook->arg);
+            }
+        }
+        ret = run_locked(mux_chan, fn, arg);
+    }
+
+    if (ret == 0)
+    {
+        fault_stats.recovered++;
+    }
+    else
+    {
+        fault_stats.failed++;
+    }
+    fault_stats.last_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    fault_stats.max_us = MAX(fault_stats.max_us, fault_stats.last_us);
+    return ret;
+}
+
+#endif /* CONFIG_HX_BUS_RECOVERY */
+
+
+static int run_txn(const struct hx_bus_txn *txn, uint8_t mux_chan)
+{
+    int ret;
+
+    hx_bus_lock(txn->client);
+    ret = run_locked(mux_chan, txn->fn, txn->arg);
+#if defined(CONFIG_HX_BUS_RECOVERY)
+    if (bus_fault(ret) && (txn->flags & HX_BUS_NO_RECOVER) == 0)
+    {
+        ret = recover(txn->bus != NULL ? txn->bus : hx_i2c, mux_chan, txn->fn, txn->arg, ret);
+    }
+#endif
+    hx_bus_unlock();
+    return ret;
+}
+
+
+int hx_bus_run(enum hx_client client, uint8_t mux_chan, hx_bus_fn_t fn, void *arg)
+{
+    const struct hx_bus_txn txn = { .client = client, .fn = fn, .arg = arg };
+
+    return run_txn(&txn, mux_chan);
+}
+
+
+void hx_bus_submit(struct hx_bus_txn *txn)
+{
+    k_spinlock_key_t key = k_spin_lock(&queue_lock);
+
+    sys_slist_append(&queue, &txn->node);
+    k_spin_unlock(&queue_lock, key);
+
+    k_work_submit_to_queue(&hx_bus_q, &drain_work);
+}
+
+
+/*
+ * Move every queued txn for one channel onto group, keeping their order.
+ * The channel already selected goes first, then whichever channel heads the queue.
+ */
+static uint8_t take_group(sys_slist_t *group)
+{
+    struct hx_bus_txn *txn;
+    struct hx_bus_txn *tmp;
+    sys_snode_t *prev = NULL;
+    uint8_t chan = HX_MUX_NONE;
+    bool found = false;
+    k_spinlock_key_t key = k_spin_lock(&queue_lock);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&queue, txn, node)
+    {
+        if (txn->mux_chan == hx_mux_current())
+        {
+            chan = txn->mux_chan;
+            found = true;
+            break;
+        }
+    }
+    if (!found && !sys_slist_is_empty(&queue))
+    {
+        chan = CONTAINER_OF(sys_slist_peek_head(&queue), struct hx_bus_txn, node)->mux_chan;
+        found = true;
+    }
+
+    if (found)
+    {
+        SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&queue, txn, tmp, node)
+        {
+            if (txn->mux_chan == chan)
+            {
+                sys_slist_remove(&queue, prev, &txn->node);
+                sys_slist_append(group, &txn->node);
+            }
+            else
+            {
+                prev = &txn->node;
+            }
+        }
+    }
+    k_spin_unlock(&queue_lock, key);
+    return found ? chan : HX_MUX_NONE;
+}
+
+
+static void drain_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    while (1)
+    {
+        sys_slist_t group;
+        sys_snode_t *node;
+        uint8_t chan;
+
+        sys_slist_init(&group);
+        chan = take_group(&group);
+        if (sys_slist_is_empty(&group))
+        {
+            return;
+        }
+
+        /*
+         * The bus is released between transactions so a waiting indicator
+         * write gets in after at most one queued transaction; the cached
+         * mux channel keeps the rest of the group from paying for a select.
+         */
+        while ((node = sys_slist_get(&group)) != NULL)
+        {
+            struct hx_bus_txn *txn = CONTAINER_OF(node, struct hx_bus_txn, node);
+            int ret = run_txn(txn, chan);
+
+            if (txn->done != NULL)
+            {
+                txn->done(txn, ret);
+            }
+        }
+    }
+}
+
+
+uint32_t hx_bus_bitrate(void)
+{
+    return bitrate;
+}
+
+
+int hx_bus_set_bitrate(uint32_t hz)
+{
+    uint32_t speed;
+    int ret;
+
+    switch (hz)
+    {
+        case I2C_BITRATE_STANDARD:  speed = I2C_SPEED_STANDARD;  break;
+        case I2C_BITRATE_FAST:      speed = I2C_SPEED_FAST;      break;
+        case I2C_BITRATE_FAST_PLUS: speed = I2C_SPEED_FAST_PLUS; break;
+        default:                    return -EINVAL;
+    }
+
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    ret = i2c_configure(hx_i2c, I2C_MODE_CONTROLLER | I2C_SPEED_SET(speed));
+    if (ret == 0)
+    {
+        bitrate = hz;
+    }
+    k_mutex_unlock(&bus_lock);
+    return ret;
+}
+
+
+uint32_t hx_bus_xfer_us(size_t bytes)
+{
+    uint64_t bits = (uint64_t)bytes * 9 + 2;            // 8 data + ACK per byte, START and STOP
+
+    return (uint32_t)DIV_ROUND_UP(bits * USEC_PER_SEC, bitrate);
+}
+
+
+uint32_t hx_bus_cadence(uint32_t n)
+{
+    return n * MAX(bitrate / I2C_BITRATE_STANDARD, 1);
+}
+
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+
+void hx_bus_restore_register(struct hx_bus_restore *hook)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    sys_slist_append(&restore_hooks, &hook->node);
+    k_mutex_unlock(&bus_lock);
+    LOG_INF("Fault recovery bound %u us per single-transfer transaction", hx_bus_recovery_bound_us(1));
+}
+
+
+/* True if the bus owner's transaction has outrun the transfer timeout budget */
+static bool xfer_stuck(void)
+{
+    uint32_t start = (uint32_t)atomic_get(&xfer_start);
+
+    return start != 0 && k_cyc_to_us_floor32(k_cycle_get_32() - start) > CONFIG_HX_BUS_XFER_TIMEOUT_US;
+}
+
+
+static void bus_clear(void)
+{
+    if (i2c_recover_bus(hx_i2c) != 0)
+    {
+        LOG_WRN("Bus clear not supported or failed");
+    }
+}
+
+
+int hx_bus_reset(k_timeout_t timeout)
+{
+    struct hx_bus_restore *hook;
+    bool cleared = false;
+
+    /*
+     * Without the lock only for a holder stuck mid-transfer, which just sees
+     * it fail. A long but healthy holder (bench, retry backoff) or a starved
+     * worker must not have the clocks land in the middle of a good transfer.
+     */
+    if (xfer_stuck())
+    {
+        bus_clear();
+        cleared = true;
+    }
+    if (k_mutex_lock(&bus_lock, timeout) != 0)
+    {
+        return -EAGAIN;
+    }
+    if (!cleared)
+    {
+        bus_clear();
+    }
+    hx_mux_invalidate();
+    fault_stats.bus_clears++;
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+    inject.stuck = false;
+#endif
+    SYS_SLIST_FOR_EACH_CONTAINER(&restore_hooks, hook, node)
+    {
+        (void)run_locked(hook->mux_chan, hook->fn, hook->arg);
+    }
+    k_mutex_unlock(&bus_lock);
+    return 0;
+}
+
+
+void hx_bus_fault_stats_get(struct hx_bus_fault_stats *out)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    *out = fault_stats;
+    k_mutex_unlock(&bus_lock);
+}
+
+
+uint32_t hx_bus_recovery_bound_us(uint32_t xfers)
+{
+    uint32_t backoff = CONFIG_HX_BUS_RETRY_BACKOFF_US * (BIT(CONFIG_HX_BUS_RETRIES) - 1) +
+                       CONFIG_HX_BUS_RETRIES * k_ticks_to_us_ceil32(1);     // k_usleep() rounds up to a tick
+    uint32_t timeouts = (CONFIG_HX_BUS_RETRIES + 2) * xfers;               // first try, retries, try after the clear
+    struct hx_bus_restore *hook;
+
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    SYS_SLIST_FOR_EACH_CONTAINER(&restore_hooks, hook, node)
+    {
+        timeouts += hook->xfers + IS_ENABLED(CONFIG_HX_MUX);    // its writes, after a select
+    }
+    k_mutex_unlock(&bus_lock);
+    timeouts += IS_ENABLED(CONFIG_HX_MUX);                  // re-select for the try after the clear
+
+    return backoff + timeouts * CONFIG_HX_BUS_XFER_TIMEOUT_US + CONFIG_HX_BUS_CLEAR_US;
+}
+
+#endif /* CONFIG_HX_BUS_RECOVERY */
+
+
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+
+void hx_bus_fault_inject(enum hx_bus_fault fault, uint16_t count)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    inject.err = fault == HX_BUS_FAULT_TIMEOUT ? -ETIMEDOUT : -EIO;
+    inject.pending = fault == HX_BUS_FAULT_STUCK ? 0 : count;
+    inject.stuck = fault == HX_BUS_FAULT_STUCK;
+    k_mutex_unlock(&bus_lock);
+}
+
+#endif /* CONFIG_HX_BUS_FAULT_INJECT */
+
+
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+
+void hx_bus_stats_get(enum hx_client client, struct hx_bus_client_stats *out)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);                 // not hx_bus_lock(), reading must not skew the numbers
+    *out = client_stats[client];
+    k_mutex_unlock(&bus_lock);
+}
+
+
+void hx_bus_stats_reset(void)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    memset(client_stats, 0, sizeof(client_stats));
+    k_mutex_unlock(&bus_lock);
+}
+
+
+static void hist_log(const char *name, const char *what, const struct hx_bus_hist *h)
+{
+    char line[HX_BUS_HIST_BUCKETS * 11 + 1];            // " %u" is at most 11 chars
+    size_t len = 0;
+
+    line[0] = '\0';
+    for (int n = 0; n < HX_BUS_HIST_BUCKETS && len < sizeof(line); n++)
+    {
+        len += snprintk(&line[len], sizeof(line) - len, " %u", h->bucket[n]);
+    }
+    LOG_INF("%-9s %s n=%u max=%uus |%s", name, what, h->count, h->max_us, line);
+}
+
+
+void hx_bus_stats_dump(void)
+{
+    struct hx_bus_client_stats snap;
+
+    LOG_INF("HX bus contention, buckets are log2(us): <2 <4 <8 ... >=32768");
+    for (int c = 0; c < HX_CLIENT_COUNT; c++)
+    {
+        hx_bus_stats_get(c, &snap);
+        if (snap.wait.count != 0)
+        {
+            hist_log(client_names[c], "wait", &snap.wait);
+            hist_log(client_names[c], "hold", &snap.hold);
+        }
+    }
+}
+
+#endif /* CONFIG_HX_BUS_LOCK_STATS */
+
+
+const char *hx_bus_client_name(enum hx_client client)
+{
+    return client < HX_CLIENT_COUNT ? client_names[client] : "?";
+}
+
+
+#if defined(CONFIG_HX_BUS_TRACE)
+
+void hx_bus_trace_arm(uint16_t count)
+{
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    trace_len = 0;
+    trace_armed = MIN(count, ARRAY_SIZE(trace));
+    k_mutex_unlock(&bus_lock);
+}
+
+
+size_t hx_bus_trace_get(struct hx_bus_trace_entry *out, size_t max, uint16_t *armed)
+{
+    size_t n;
+
+    k_mutex_lock(&bus_lock, K_FOREVER);
+    n = MIN(max, trace_len);
+    memcpy(out, trace, n * sizeof(*out));
+    if (armed != NULL)
+    {
+        *armed = trace_armed;
+    }
+    k_mutex_unlock(&bus_lock);
+    return n;
+}
+
+#endif /* CONFIG_HX_BUS_TRACE */
+
+
+static int hx_bus_init(void)
+{
+    k_work_init(&drain_work, drain_handler);
+    k_work_queue_start(&hx_bus_q, hx_bus_stack, K_THREAD_STACK_SIZEOF(hx_bus_stack),
+                       CONFIG_HX_BUS_THREAD_PRIORITY, NULL);
+    k_thread_name_set(&hx_bus_q.thread, "hx_bus");
+    return 0;
+}
+
+SYS_INIT(hx_bus_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
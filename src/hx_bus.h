@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_BUS_H_
+#define HX_BUS_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+#define HX_MUX_NONE 0xFF            /* part sits on the trunk, no channel select */
+
+enum hx_client {
+    HX_CLIENT_INDICATOR,
+    HX_CLIENT_SENSORS,
+    HX_CLIENT_IMU,
+    HX_CLIENT_ENUM,
+    HX_CLIENT_SHELL,
+    HX_CLIENT_COUNT
+};
+
+/* Bus work, called with the HX bus held and the client's mux channel selected */
+typedef int (*hx_bus_fn_t)(void *arg);
+
+/* Transaction flags */
+#define HX_BUS_NO_RECOVER BIT(0)       /* a failure is an answer (a probe NACK), return it without retry or bus clear */
+
+struct hx_bus_txn {
+    sys_snode_t node;
+    enum hx_client client;
+    uint8_t mux_chan;
+    uint8_t flags;
+    const struct device *bus;       /* controller fn talks to, cleared on a fault; NULL = the HX bus */
+    hx_bus_fn_t fn;
+    void *arg;
+    void (*done)(struct hx_bus_txn *txn, int result);      /* optional, runs on the bus worker */
+};
+
+#define HX_BUS_HIST_BUCKETS 16     /* bucket n counts [2^n, 2^(n+1)) us, last bucket open ended */
+
+struct hx_bus_hist {
+    uint32_t bucket[HX_BUS_HIST_BUCKETS];
+    uint32_t count;
+    uint32_t max_us;
+};
+
+struct hx_bus_client_stats {
+    struct hx_bus_hist wait;    /* time from lock request to ownership */
+    struct hx_bus_hist hold;    /* time the bus was held per transaction */
+};
+
+/**
+ * Take the HX bus. This is a k_mutex, so a low priority holder inherits the
+ * priority of the highest waiter; every bus user must come through here for
+ * that to hold.
+ */
+void hx_bus_lock(enum hx_client client);
+
+void hx_bus_unlock(void);
+
+/**
+ * Run fn now on the caller's thread with the bus held.
+ *
+ * @return fn's result, or a negative errno if the mux channel could not be selected
+ */
+int hx_bus_run(enum hx_client client, uint8_t mux_chan, hx_bus_fn_t fn, void *arg);
+
+/**
+ * Queue fn for the bus worker. Queued work is drained grouped by mux channel
+ * (FIFO within a channel) so a burst of mixed clients costs one select per
+ * channel. txn must stay valid until done() is called.
+ */
+void hx_bus_submit(struct hx_bus_txn *txn);
+
+/** Current HX bus clock in Hz (devicetree clock-frequency until changed). */
+uint32_t hx_bus_bitrate(void);
+
+/**
+ * Reclock the HX bus to I2C_BITRATE_STANDARD, _FAST or _FAST_PLUS.
+ *
+ * @return 0, -EINVAL for other rates, or the controller's error if it cannot run at hz
+ */
+int hx_bus_set_bitrate(uint32_t hz);
+
+/** Wire time of a transfer of bytes (address byte included) at the current clock. */
+uint32_t hx_bus_xfer_us(size_t bytes);
+
+/**
+ * Per-frame cadence n (set for standard mode) scaled up with the current
+ * clock. The indicator's frame cap rises with the clock, so piggybacked work
+ * folded into n times as many frames keeps the same rate per second.
+ */
+uint32_t hx_bus_cadence(uint32_t n);
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+/* Replayed with the bus held after a bus clear, to put parts back in a known state */
+struct hx_bus_restore {
+    sys_snode_t node;
+    uint8_t mux_chan;
+    uint8_t xfers;              /* most transfers fn makes, for the recovery bound */
+    hx_bus_fn_t fn;
+    void *arg;
+};
+
+struct hx_bus_fault_stats {
+    uint32_t faults;            /* transactions that failed with NACK/timeout */
+    uint32_t retries;
+    uint32_t bus_clears;
+    uint32_t recovered;
+    uint32_t failed;
+    uint32_t last_us;           /* fault to outcome, last recovery */
+    uint32_t max_us;
+};
+
+void hx_bus_restore_register(struct hx_bus_restore *hook);
+
+void hx_bus_fault_stats_get(struct hx_bus_fault_stats *stats);
+
+/**
+ * Clear the bus and replay the restore hooks with it held. If the holder's
+ * transaction has run past CONFIG_HX_BUS_XFER_TIMEOUT_US, the clear goes out
+ * first, without the lock, to abort it; otherwise it waits for the lock.
+ *
+ * @retval -EAGAIN the bus was not released within timeout
+ */
+int hx_bus_reset(k_timeout_t timeout);
+
+/**
+ * Worst-case time from a fault to hx_bus_run() returning, from the Kconfig
+ * budget: every attempt and every restore hook transfer timing out, the mux
+ * selects, and each backoff sleep rounded up by a tick.
+ *
+ * @param xfers transfers the failing transaction's fn makes per attempt
+ */
+uint32_t hx_bus_recovery_bound_us(uint32_t xfers);
+#endif
+
+#if defined(CONFIG_HX_BUS_FAULT_INJECT)
+enum hx_bus_fault {
+    HX_BUS_FAULT_NACK,          /* next count transactions fail with -EIO */
+    HX_BUS_FAULT_TIMEOUT,       /* next count transactions fail with -ETIMEDOUT */
+    HX_BUS_FAULT_STUCK,         /* every transaction fails until a bus clear */
+};
+
+/** Fail upcoming transactions before they reach the bus, to exercise recovery. */
+void hx_bus_fault_inject(enum hx_bus_fault fault, uint16_t count);
+#endif
+
+const char *hx_bus_client_name(enum hx_client client);
+
+#if defined(CONFIG_HX_BUS_TRACE)
+struct hx_bus_trace_entry {
+    uint32_t at_us;             /* cycle counter at start, in us (wraps) */
+    uint32_t dur_us;            /* mux select + fn */
+    hx_bus_fn_t fn;
+    int16_t result;
+    uint8_t client;             /* enum hx_client holding the bus */
+    uint8_t mux_chan;
+};
+
+/** Record the next count transactions (at most CONFIG_HX_BUS_TRACE_DEPTH), dropping the last capture. */
+void hx_bus_trace_arm(uint16_t count);
+
+/**
+ * Copy out the capture so far.
+ *
+ * @param armed if not NULL, set to the number of transactions still to be recorded
+ * @return entries copied
+ */
+size_t hx_bus_trace_get(struct hx_bus_trace_entry *out, size_t max, uint16_t *armed);
+#endif
+
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+/** Snapshot one client's contention histograms. */
+void hx_bus_stats_get(enum hx_client client, struct hx_bus_client_stats *stats);
+
+void hx_bus_stats_reset(void);
+
+/** Log every client's wait/hold histograms. */
+void hx_bus_stats_dump(void);
+#endif
+
+#endif /* HX_BUS_H_ */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HX bus enumeration. The presence map is probed once on a cold boot and kept
+ * in no-init RAM (guarded by a CRC), so warm resets reuse it without touching
+ * the bus. The cold scan is queued on the bus worker rather than run from init,
+ * so a missing part's NACKs and retries do not hold up boot; results arrive
+ * through the change callback. A slow background re-probe picks up hot-plugged or removed parts;
+ * each probe is a separate queued bus transaction so the indicator never
+ * waits behind more than one probe.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_enum, LOG_LEVEL_INF);
+
+#include "hx_bus.h"
+#include "hx_mux.h"
+#include "hx_enum.h"
+
+#define HX_BUS_NODE DT_BUS(DT_NODELABEL(rgbctrl))
+
+#define RETAINED_MAGIC 0x48584531                   // "HXE1"
+
+/* Parts with a devicetree node are probed where the node says, otherwise at the MTC.2 default on the HX bus */
+#define PART_BUS(label) \
+    DEVICE_DT_GET_OR_NULL(COND_CODE_1(DT_NODE_EXISTS(DT_NODELABEL(label)), (DT_BUS(DT_NODELABEL(label))), (HX_BUS_NODE)))
+#define PART_ADDR(label, dflt) \
+    COND_CODE_1(DT_NODE_EXISTS(DT_NODELABEL(label)), (DT_REG_ADDR(DT_NODELABEL(label))), (dflt))
+
+struct hx_probe {
+    const char *name;
+    const struct device *bus;
+    uint16_t addr;
+    enum hx_client client;      /* selects the mux channel the part sits behind */
+    int16_t cmd;                /* command byte to write as the probe, -1 = one-byte read */
+};
+
+static const struct hx_probe parts[HX_PART_COUNT] = {
+    [HX_PART_INDICATOR] = { "lp5817", PART_BUS(rgbctrl), PART_ADDR(rgbctrl, 0x2d), HX_CLIENT_INDICATOR, -1 },
+    [HX_PART_SHT] = { "sht45", PART_BUS(sht), PART_ADDR(sht, 0x44), HX_CLIENT_SENSORS, 0x89 },   // read serial, SHT4x NACKs bare reads
+    [HX_PART_BMP] = { "bmp581", PART_BUS(bmp), PART_ADDR(bmp, 0x47), HX_CLIENT_SENSORS, -1 },
+    [HX_PART_IMU] = { "imu", PART_BUS(imu), PART_ADDR(imu, 0x6a), HX_CLIENT_IMU, -1 },
+};
+
+static struct {
+    uint32_t magic;
+    uint32_t present;
+    uint32_t crc;
+} retained __noinit;
+
+static hx_enum_cb_t change_cb;
+static uint32_t present;                            // last complete round, retained only once there is one
+static uint32_t scan_map;
+static atomic_t outstanding;                        // probes of this round not done yet
+static struct hx_bus_txn probe_txn[HX_PART_COUNT];
+static struct k_work_delayable hotplug_work;
+
+
+static int probe(void *arg)
+{
+    const struct hx_probe *p = arg;
+    uint8_t b = (uint8_t)p->cmd;
+
+    if (p->bus == NULL || !device_is_ready(p->bus))
+    {
+        return -ENODEV;
+    }
+    return p->cmd < 0 ? i2c_read(p->bus, &b, 1, p->addr) : i2c_write(p->bus, &b, 1, p->addr);
+}
+
+
+static bool retained_valid(void)
+{
+    return retained.magic == RETAINED_MAGIC &&
+           retained.crc == crc32_ieee((const uint8_t *)&retained.present, sizeof(retained.present));
+}
+
+
+static void retained_store(uint32_t present)
+{
+    retained.magic = RETAINED_MAGIC;
+    retained.present = present;
+    retained.crc = crc32_ieee((const uint8_t *)&retained.present, sizeof(retained.present));
+}
+
+
+static void probe_done(struct hx_bus_txn *txn, int result)
+{
+    size_t part = txn - probe_txn;
+    uint32_t changed;
+
+    WRITE_BIT(scan_map, part, result == 0);
+    if (atomic_dec(&outstanding) != 1)
+    {
+        return;                                     // the queue regroups by channel, any probe may finish last
+    }
+
+    /* whole round in, publish any change */
+    changed = scan_map ^ present;
+    present = scan_map;
+    retained_store(present);                        // a warm reset may trust it from here on
+    if (changed != 0)
+    {
+        for (size_t i = 0; i < HX_PART_COUNT; i++)
+        {
+            if (changed & BIT(i))
+            {
+                LOG_INF("%s %s", parts[i].name, (scan_map & BIT(i)) ? "attached" : "removed");
+            }
+        }
+        if (change_cb != NULL)
+        {
+            change_cb(scan_map, changed);
+        }
+    }
+    if (CONFIG_HX_ENUM_HOTPLUG_PERIOD_S > 0)
+    {
+        k_work_schedule(&hotplug_work, K_SECONDS(CONFIG_HX_ENUM_HOTPLUG_PERIOD_S));
+    }
+}
+
+
+static void hotplug_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    atomic_set(&outstanding, HX_PART_COUNT);
+    for (size_t i = 0; i < HX_PART_COUNT; i++)
+    {
+        probe_txn[i].client = HX_CLIENT_ENUM;
+        probe_txn[i].mux_chan = hx_mux_channel(parts[i].client);
+        probe_txn[i].flags = HX_BUS_NO_RECOVER;             // an absent part NACKs, that is the answer
+        probe_txn[i].bus = parts[i].bus;
+        probe_txn[i].fn = probe;
+        probe_txn[i].arg = (void *)&parts[i];
+        probe_txn[i].done = probe_done;
+        hx_bus_submit(&probe_txn[i]);
+    }
+}
+
+
+uint32_t hx_enum_present(void)
+{
+    return present;
+}
+
+
+void hx_enum_set_callback(hx_enum_cb_t cb)
+{
+    change_cb = cb;
+}
+
+
+static int hx_enum_init(void)
+{
+    k_work_init_delayable(&hotplug_work, hotplug_handler);
+
+    if (retained_valid())
+    {
+        present = retained.present;
+        LOG_INF("Warm boot, presence 0x%02x from retained RAM", present);
+        if (CONFIG_HX_ENUM_HOTPLUG_PERIOD_S > 0)
+        {
+            k_work_schedule(&hotplug_work, K_SECONDS(CONFIG_HX_ENUM_HOTPLUG_PERIOD_S));
+        }
+    }
+    else
+    {
+        retained.magic = 0;                             // a reset before the first round ends scans again
+        LOG_INF("Cold boot, scan queued");
+        k_work_schedule(&hotplug_work, K_NO_WAIT);
+    }
+    return 0;
+}
+
+SYS_INIT(hx_enum_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
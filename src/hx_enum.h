@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_ENUM_H_
+#define HX_ENUM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum hx_part {
+    HX_PART_INDICATOR,          /* LP5817 @ 0x2d */
+    HX_PART_SHT,                /* SHT45 @ 0x44 */
+    HX_PART_BMP,                /* BMP581 @ 0x47 */
+    HX_PART_IMU,                /* Sensor-1 IMU @ 0x6a */
+    HX_PART_COUNT
+};
+
+/* Called from the HX bus worker when a hot-plug re-probe changes the map. */
+typedef void (*hx_enum_cb_t)(uint32_t present, uint32_t changed);
+
+/** Bitmap of fitted parts, BIT(enum hx_part). */
+uint32_t hx_enum_present(void);
+
+static inline bool hx_enum_is_present(enum hx_part part)
+{
+    return (hx_enum_present() & (1U << part)) != 0;
+}
+
+void hx_enum_set_callback(hx_enum_cb_t cb);
+
+#endif /* HX_ENUM_H_ */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sensor-1 IMU event path. The IMU buffers accelerometer frames in its FIFO
+ * and raises the watermark interrupt; each wake burst-reads the whole FIFO,
+ * scans it for motion and tap signatures and kicks an indicator pattern.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_imu, LOG_LEVEL_INF);
+
+#include "indicator.h"
+#include "hx_init.h"
+#include "sensor_q31.h"
+
+#define IMU_NODE DT_NODELABEL(imu)
+
+#define G_MMS2 9807                                 // 1 g in mm/s^2
+
+#if defined(CONFIG_INDICATOR_EDF)
+#define TAP_DEADLINE_MS CONFIG_INDICATOR_EDF_TAP_MS
+#else
+#define TAP_DEADLINE_MS 0                           // ignored, played as a plain request
+#endif
+
+static const struct device *const imu = DEVICE_DT_GET(IMU_NODE);
+
+SENSOR_DT_STREAM_IODEV(imu_stream, IMU_NODE, {SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE});
+RTIO_DEFINE_WITH_MEMPOOL(imu_rtio, 2, 2, 32, 64, sizeof(void *));
+
+static uint32_t motion_events;
+static uint32_t tap_events;
+
+
+/* |a| outside (1g +/- thr), compared squared to stay in integer math */
+static bool beyond(int64_t mag2, int32_t thr)
+{
+    int64_t hi = (int64_t)(G_MMS2 + thr) * (G_MMS2 + thr);
+    int64_t lo = thr < G_MMS2 ? (int64_t)(G_MMS2 - thr) * (G_MMS2 - thr) : 0;
+
+    return mag2 > hi || mag2 < lo;
+}
+
+
+/* Scan one FIFO burst. Returns the pattern to show, or NULL. */
+static const struct indicator_pattern *scan_burst(const uint8_t *buf, uint64_t *origin_ns)
+{
+    const struct sensor_decoder_api *decoder;
+    struct sensor_chan_spec spec = {SENSOR_CHAN_ACCEL_XYZ, 0};
+    uint16_t frames = 0;
+    uint32_t fit = 0;
+    uint16_t moving = 0;
+    uint8_t spike = 0;
+    bool tap = false;
+
+    if (sensor_get_decoder(imu, &decoder) != 0 ||
+        decoder->get_frame_count(buf, spec, &frames) != 0)
+    {
+        return NULL;
+    }
+
+    for (uint16_t i = 0; i < frames; i++)
+    {
+        struct sensor_three_axis_data data = {0};
+        int64_t x, y, z, mag2;
+
+        if (decoder->decode(buf, spec, &fit, 1, &data) <= 0)
+        {
+            break;
+        }
+        if (i == 0)
+        {
+            *origin_ns = data.header.base_timestamp_ns;
+        }
+        x = q31_to_milli(data.readings[0].x, data.shift);
+        y = q31_to_milli(data.readings[0].y, data.shift);
+        z = q31_to_milli(data.readings[0].z, data.shift);
+        mag2 = x * x + y * y + z * z;
+
+        if (beyond(mag2, CONFIG_HX_IMU_MOTION_THRESHOLD_MMS2))
+        {
+            moving++;
+        }
+
+        /* a tap is a short spike (one or two frames) that settles again */
+        if (beyond(mag2, CONFIG_HX_IMU_TAP_THRESHOLD_MMS2))
+        {
+            spike++;
+        }
+        else
+        {
+            tap |= spike > 0 && spike <= 2;
+            spike = 0;
+        }
+    }
+
+    if (tap)
+    {
+        tap_events++;
+        return &indicator_pattern_tap;
+    }
+    if (moving >= CONFIG_HX_IMU_MOTION_MIN_FRAMES)
+    {
+        motion_events++;
+        return &indicator_pattern_motion;
+    }
+    return NULL;
+}
+
+
+static void report(uint64_t *window_start, uint64_t *busy_start)
+{
+    k_thread_runtime_stats_t rt;
+    struct indicator_stats ind;
+    uint64_t now = k_cycle_get_64();
+    uint64_t busy;
+
+    if (k_thread_runtime_stats_get(k_current_get(), &rt) != 0)
+    {
+        return;
+    }
+    busy = rt.execution_cycles - *busy_start;
+    indicator_stats_get(&ind);
+
+    LOG_INF("motion %u tap %u, irq->led last %u us max %u us, cpu %u.%02u%%",
+            motion_events, tap_events, ind.lat_last_us, ind.lat_max_us,
+            (uint32_t)(busy * 100 / (now - *window_start)),
+            (uint32_t)(busy * 10000 / (now - *window_start) % 100));
+
+    *window_start = now;
+    *busy_start = rt.execution_cycles;
+}
+
+
+static void imu_thread(void *p1, void *p2, void *p3)
+{
+    struct rtio_sqe *handle;
+    uint64_t window_start = k_cycle_get_64();
+    uint64_t busy_start = 0;
+    int64_t next_report = k_uptime_get() + CONFIG_HX_IMU_REPORT_S * MSEC_PER_SEC;
+
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    if (hx_init_wait(imu, K_FOREVER) != 0 || sensor_stream(&imu_stream, &imu_rtio, NULL, &handle) != 0)
+    {
+        LOG_ERR("IMU FIFO stream unavailable");
+        return;
+    }
+
+    while (1)
+    {
+        struct rtio_cqe *cqe = rtio_cqe_consume_block(&imu_rtio);
+        const struct indicator_pattern *pattern = NULL;
+        uint64_t origin_ns = 0;
+        uint8_t *buf;
+        uint32_t buf_len;
+
+        if (cqe->result >= 0 && rtio_cqe_get_mempool_buffer(&imu_rtio, cqe, &buf, &buf_len) == 0)
+        {
+            pattern = scan_burst(buf, &origin_ns);
+            rtio_release_buffer(&imu_rtio, buf, buf_len);
+        }
+        rtio_cqe_release(&imu_rtio, cqe);
+
+        if (pattern != NULL)
+        {
+            uint32_t origin = (uint32_t)k_ns_to_cyc_floor64(origin_ns);    // taken by the driver in the watermark ISR
+
+            if (pattern == &indicator_pattern_tap)
+            {
+                indicator_play_by(pattern, origin, TAP_DEADLINE_MS);
+            }
+            else
+            {
+                indicator_play_from(pattern, origin);
+            }
+        }
+
+        if (IS_ENABLED(CONFIG_THREAD_RUNTIME_STATS) && k_uptime_get() >= next_report)
+        {
+            report(&window_start, &busy_start);
+            next_report += CONFIG_HX_IMU_REPORT_S * MSEC_PER_SEC;
+        }
+    }
+}
+
+K_THREAD_DEFINE(hx_imu, 1536, imu_thread, NULL, NULL, NULL, CONFIG_HX_IMU_THREAD_PRIORITY, 0, 0);
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Deferred HX device init. Nodes marked zephyr,deferred-init are skipped by
+ * the kernel's init sequence; here they are only queued (the fast phase) and
+ * device_init() runs later: parts on the HX bus as queued bus transactions, so
+ * their register programming is serialized with other HX traffic under the bus
+ * lock, and parts on other buses on the system work queue, overlapping with
+ * the HX ones. Consumers wait with hx_init_wait(). The time boot no longer
+ * spends on these devices is logged once all of them are up.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/device.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_init, LOG_LEVEL_INF);
+
+#include "hx_init.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+
+#define HX_BUS_NODE DT_BUS(DT_NODELABEL(rgbctrl))
+
+struct deferred {
+    const struct device *dev;
+    const char *name;
+    bool on_hx_bus;
+    enum hx_client client;
+    uint32_t start;
+    uint32_t end;
+    union {
+        struct hx_bus_txn txn;
+        struct k_work work;
+    };
+};
+
+#define DEFERRED_ENTRY(node, _client)                                               \
+    { .dev = DEVICE_DT_GET(node), .name = DT_NODE_FULL_NAME(node),                  \
+      .on_hx_bus = DT_SAME_NODE(DT_BUS(node), HX_BUS_NODE), .client = _client },
+
+#define DEFERRED(label, client)                                                     \
+    IF_ENABLED(DT_NODE_HAS_STATUS(DT_NODELABEL(label), okay),                       \
+        (IF_ENABLED(DT_PROP(DT_NODELABEL(label), zephyr_deferred_init),             \
+            (DEFERRED_ENTRY(DT_NODELABEL(label), client)))))
+
+static struct deferred devs[] = {
+    DEFERRED(rgbctrl, HX_CLIENT_INDICATOR)
+    DEFERRED(bmp, HX_CLIENT_SENSORS)
+    DEFERRED(sht, HX_CLIENT_SENSORS)
+    DEFERRED(imu, HX_CLIENT_IMU)
+};
+
+static K_EVENT_DEFINE(ready_events);
+static atomic_t remaining;
+static struct hx_init_stats stats;
+
+
+static int find(const struct device *dev)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(devs); i++)
+    {
+        if (devs[i].dev == dev)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+static void finished(struct deferred *d, int ret)
+{
+    d->end = k_cycle_get_32();
+    if (ret != 0)
+    {
+        stats.failed++;
+        LOG_ERR("%s init failed (%d)", d->name, ret);
+    }
+    k_event_post(&ready_events, BIT(d - devs));
+
+    if (atomic_dec(&remaining) == 1)                        // last one
+    {
+        uint32_t first = devs[0].start;
+        uint32_t last = devs[0].end;
+
+        for (size_t i = 0; i < ARRAY_SIZE(devs); i++)
+        {
+            stats.serial_us += k_cyc_to_us_floor32(devs[i].end - devs[i].start);
+            first = (int32_t)(devs[i].start - first) < 0 ? devs[i].start : first;
+            last = (int32_t)(devs[i].end - last) > 0 ? devs[i].end : last;
+        }
+        stats.wall_us = k_cyc_to_us_floor32(last - first);
+        LOG_INF("Deferred init of %u devices: %u us in boot, %u us serial, %u us wall, boot saved %u us",
+                stats.devices, stats.boot_us, stats.serial_us, stats.wall_us,
+                stats.serial_us > stats.boot_us ? stats.serial_us - stats.boot_us : 0);
+    }
+}
+
+
+static int init_on_bus(void *arg)
+{
+    struct deferred *d = arg;
+
+    d->start = k_cycle_get_32();
+    return device_init(d->dev);
+}
+
+
+static void bus_done(struct hx_bus_txn *txn, int result)
+{
+    finished(CONTAINER_OF(txn, struct deferred, txn), result);
+}
+
+
+static void init_work(struct k_work *work)
+{
+    struct deferred *d = CONTAINER_OF(work, struct deferred, work);
+
+    d->start = k_cycle_get_32();
+    finished(d, device_init(d->dev));
+}
+
+
+bool hx_init_ready(const struct device *dev)
+{
+    int i = find(dev);
+
+    return i < 0 ? device_is_ready(dev) : (k_event_test(&ready_events, BIT(i)) != 0 && device_is_ready(dev));
+}
+
+
+int hx_init_wait(const struct device *dev, k_timeout_t timeout)
+{
+    int i = find(dev);
+
+    if (i >= 0 && k_event_wait(&ready_events, BIT(i), false, timeout) == 0)
+    {
+        return -EAGAIN;
+    }
+    return device_is_ready(dev) ? 0 : -ENODEV;
+}
+
+
+void hx_init_stats_get(struct hx_init_stats *out)
+{
+    *out = stats;
+}
+
+
+static int hx_init_start(void)
+{
+    uint32_t t0 = k_cycle_get_32();
+
+    stats.devices = ARRAY_SIZE(devs);
+    atomic_set(&remaining, ARRAY_SIZE(devs));
+
+    for (size_t i = 0; i < ARRAY_SIZE(devs); i++)
+    {
+        struct deferred *d = &devs[i];
+
+        if (d->on_hx_bus)
+        {
+            d->txn.client = d->client;
+            d->txn.mux_chan = hx_mux_channel(d->client);
+            d->txn.fn = init_on_bus;
+            d->txn.arg = d;
+            d->txn.done = bus_done;
+            hx_bus_submit(&d->txn);
+        }
+        else
+        {
+            k_work_init(&d->work, init_work);
+            k_work_submit(&d->work);
+        }
+    }
+    stats.boot_us = k_cyc_to_us_floor32(k_cycle_get_32() - t0);
+    return 0;
+}
+
+SYS_INIT(hx_init_start, POST_KERNEL, CONFIG_HX_DEFERRED_INIT_PRIORITY);
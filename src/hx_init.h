@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_INIT_H_
+#define HX_INIT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/toolchain.h>
+
+struct hx_init_stats {
+    uint8_t devices;            /* deferred devices */
+    uint8_t failed;
+    uint32_t boot_us;           /* time the init sequence spent on them (queueing only) */
+    uint32_t wall_us;           /* first start to last finish */
+    uint32_t serial_us;         /* sum of the individual init times, what boot used to pay */
+};
+
+/* A deferred node nobody brings up stays uninitialized forever */
+#define HX_INIT_DEFERRED(label)                                                     \
+    (DT_NODE_HAS_STATUS(DT_NODELABEL(label), okay) &&                               \
+     DT_PROP_OR(DT_NODELABEL(label), zephyr_deferred_init, 0))
+
+BUILD_ASSERT(IS_ENABLED(CONFIG_HX_DEFERRED_INIT) ||
+             !(HX_INIT_DEFERRED(rgbctrl) || HX_INIT_DEFERRED(bmp) ||
+               HX_INIT_DEFERRED(sht) || HX_INIT_DEFERRED(imu)),
+             "zephyr,deferred-init on an HX device needs CONFIG_HX_DEFERRED_INIT");
+
+#if defined(CONFIG_HX_DEFERRED_INIT)
+
+/** True once dev is initialized, whether it was deferred or not. */
+bool hx_init_ready(const struct device *dev);
+
+/**
+ * Wait for a deferred device's init to finish.
+ *
+ * @retval 0 ready, -EAGAIN on timeout, -ENODEV if its init failed
+ */
+int hx_init_wait(const struct device *dev, k_timeout_t timeout);
+
+void hx_init_stats_get(struct hx_init_stats *stats);
+
+#else
+
+static inline bool hx_init_ready(const struct device *dev) { return device_is_ready(dev); }
+static inline int hx_init_wait(const struct device *dev, k_timeout_t timeout)
+{
+    ARG_UNUSED(timeout);
+    return device_is_ready(dev) ? 0 : -ENODEV;
+}
+
+#endif /* CONFIG_HX_DEFERRED_INIT */
+
+#endif /* HX_INIT_H_ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HX bus channel multiplexer. The selected channel is cached so a run of
+ * transactions to the same channel pays for one select write, not one each.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_mux, LOG_LEVEL_INF);
+
+#include "hx_mux.h"
+
+#define HXMUX_NODE DT_NODELABEL(hxmux)
+
+static const struct i2c_dt_spec mux = I2C_DT_SPEC_GET(HXMUX_NODE);
+
+static const uint8_t client_chan[HX_CLIENT_COUNT] = {
+    [HX_CLIENT_INDICATOR] = DT_PROP_OR(HXMUX_NODE, indicator_channel, HX_MUX_NONE),
+    [HX_CLIENT_SENSORS] = DT_PROP_OR(HXMUX_NODE, sensor_channel, HX_MUX_NONE),
+    [HX_CLIENT_IMU] = DT_PROP_OR(HXMUX_NODE, sensor_channel, HX_MUX_NONE),
+    [HX_CLIENT_ENUM] = HX_MUX_NONE,
+    [HX_CLIENT_SHELL] = HX_MUX_NONE,
+};
+
+static uint8_t current = HX_MUX_NONE;
+static struct hx_mux_stats stats;
+
+
+int hx_mux_select(uint8_t chan)
+{
+    uint8_t mask;
+    int ret;
+
+    if (chan == HX_MUX_NONE || chan == current)
+    {
+        stats.skipped += chan != HX_MUX_NONE;
+        return 0;
+    }
+
+    mask = BIT(chan);
+    ret = i2c_write_dt(&mux, &mask, 1) < 0 ? -EIO : 0;      // single control byte, no register address
+    if (ret != 0)
+    {
+        stats.errors++;
+        current = HX_MUX_NONE;
+        return ret;
+    }
+    stats.selects++;
+    current = chan;
+    return 0;
+}
+
+
+uint8_t hx_mux_current(void)
+{
+    return current;
+}
+
+
+void hx_mux_invalidate(void)
+{
+    current = HX_MUX_NONE;
+}
+
+
+uint8_t hx_mux_channel(enum hx_client client)
+{
+    return client < HX_CLIENT_COUNT ? client_chan[client] : HX_MUX_NONE;
+}
+
+
+void hx_mux_stats_get(struct hx_mux_stats *out)
+{
+    *out = stats;
+}
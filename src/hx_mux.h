@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_MUX_H_
+#define HX_MUX_H_
+
+#include <stdint.h>
+#include "hx_bus.h"
+
+struct hx_mux_stats {
+    uint32_t selects;           /* select writes issued */
+    uint32_t skipped;           /* selects satisfied by the cached channel */
+    uint32_t errors;
+};
+
+#if defined(CONFIG_HX_MUX)
+
+/* Route the bus to chan; callers must hold the HX bus. */
+int hx_mux_select(uint8_t chan);
+
+/* Channel last written, HX_MUX_NONE when unknown (boot, after a bus error). */
+uint8_t hx_mux_current(void);
+
+/* Forget the cached channel so the next select is written. */
+void hx_mux_invalidate(void);
+
+uint8_t hx_mux_channel(enum hx_client client);
+
+void hx_mux_stats_get(struct hx_mux_stats *stats);
+
+#else
+
+static inline int hx_mux_select(uint8_t chan) { ARG_UNUSED(chan); return 0; }
+static inline uint8_t hx_mux_current(void) { return HX_MUX_NONE; }
+static inline void hx_mux_invalidate(void) { }
+static inline uint8_t hx_mux_channel(enum hx_client client) { ARG_UNUSED(client); return HX_MUX_NONE; }
+
+#endif /* CONFIG_HX_MUX */
+
+#endif /* HX_MUX_H_ */
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sensor-1 sampling pipeline.
+ *
+ * The BMP581 and SHT45 are read through RTIO: in periodic mode both reads are
+ * chained into one submission per sample period, in FIFO mode the BMP581
+ * buffers a batch on-chip and the sampler only wakes on the FIFO watermark.
+ * Decoded samples are written directly into claimed ring slots and handed to
+ * the consumer a whole batch at a time, so nothing is copied after decode.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hx_sensors, LOG_LEVEL_INF);
+
+#include "hx_sensors.h"
+#include "sensor_q31.h"
+#include "wake_align.h"
+#include "hx_init.h"
+#if defined(CONFIG_HX_BUS)
+#include "hx_bus.h"
+#include "hx_mux.h"
+#endif
+
+#define BMP_NODE DT_NODELABEL(bmp)
+#define SHT_NODE DT_NODELABEL(sht)
+
+#define HAS_BMP DT_NODE_HAS_STATUS(BMP_NODE, okay)
+#define HAS_SHT DT_NODE_HAS_STATUS(SHT_NODE, okay)
+
+#define BATCH_SIZE CONFIG_HX_SENSORS_BATCH_SIZE
+
+/* Parts sharing the indicator's bus take the HX bus lock around each burst */
+#define SHARES_HX_BUS 0
+#if defined(CONFIG_HX_BUS)
+#if HAS_BMP
+#if DT_SAME_NODE(DT_BUS(BMP_NODE), DT_BUS(DT_NODELABEL(rgbctrl)))
+#undef SHARES_HX_BUS
+#define SHARES_HX_BUS 1
+#endif
+#endif
+#if HAS_SHT
+#if DT_SAME_NODE(DT_BUS(SHT_NODE), DT_BUS(DT_NODELABEL(rgbctrl)))
+#undef SHARES_HX_BUS
+#define SHARES_HX_BUS 1
+#endif
+#endif
+#endif
+
+struct hx_slot {
+    uint32_t seq;
+    uint16_t count;
+    struct hx_sample samples[BATCH_SIZE];
+};
+
+static struct hx_slot ring_storage[CONFIG_HX_SENSORS_RING_BATCHES];
+static struct ring_buf hx_ring;
+static struct hx_slot drop_slot;                        // decode target while the ring is full
+static K_SEM_DEFINE(batch_ready, 0, CONFIG_HX_SENSORS_RING_BATCHES);
+static uint32_t batch_seq;
+static uint32_t overruns;
+
+RTIO_DEFINE_WITH_MEMPOOL(hx_rtio, 4, 4, 8, 32, sizeof(void *));
+
+#if HAS_BMP
+static const struct device *const bmp_dev = DEVICE_DT_GET(BMP_NODE);
+SENSOR_DT_READ_IODEV(bmp_iodev, BMP_NODE, {SENSOR_CHAN_AMBIENT_TEMP, 0}, {SENSOR_CHAN_PRESS, 0});
+#endif
+#if HAS_SHT
+static const struct device *const sht_dev = DEVICE_DT_GET(SHT_NODE);
+SENSOR_DT_READ_IODEV(sht_iodev, SHT_NODE, {SENSOR_CHAN_AMBIENT_TEMP, 0}, {SENSOR_CHAN_HUMIDITY, 0});
+#endif
+
+#if defined(CONFIG_HX_SENSORS_BMP581_FIFO)
+SENSOR_DT_STREAM_IODEV(bmp_stream, BMP_NODE, {SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE});
+RTIO_DEFINE_WITH_MEMPOOL(hx_stream_rtio, 2, 2, 16, 32, sizeof(void *));
+#endif
+
+
+static int decode_next(const struct device *dev, const uint8_t *buf, uint16_t chan, uint32_t *fit, int32_t *milli)
+{
+    const struct sensor_decoder_api *decoder;
+    struct sensor_q31_data data = {0};
+    int ret;
+
+    ret = sensor_get_decoder(dev, &decoder);
+    if (ret != 0)
+    {
+        return ret;
+    }
+    ret = decoder->decode(buf, (struct sensor_chan_spec){chan, 0}, fit, 1, &data);
+    if (ret <= 0)
+    {
+        return ret < 0 ? ret : -ENODATA;
+    }
+    *milli = q31_to_milli(data.readings[0].value, data.shift);
+    return 0;
+}
+
+
+static struct hx_slot *slot_claim(void)
+{
+    uint8_t *data;
+
+    if (ring_buf_put_claim(&hx_ring, &data, sizeof(struct hx_slot)) < sizeof(struct hx_slot))
+    {
+        ring_buf_put_finish(&hx_ring, 0);
+        overruns++;
+        data = (uint8_t *)&drop_slot;
+    }
+    ((struct hx_slot *)data)->count = 0;
+    return (struct hx_slot *)data;
+}
+
+
+static void slot_publish(struct hx_slot *slot)
+{
+    slot->seq = batch_seq++;
+    if (slot == &drop_slot)
+    {
+        LOG_WRN("Batch %u dropped, consumer behind", slot->seq);
+        return;
+    }
+    ring_buf_put_finish(&hx_ring, sizeof(struct hx_slot));
+    k_sem_give(&batch_ready);
+}
+
+
+/* Fold one completed read into the samples it covers (first..first+count) */
+static void process_cqe(struct rtio *ctx, struct rtio_cqe *cqe, struct hx_sample *first, uint16_t count)
+{
+    const struct device *dev = cqe->userdata;
+    uint8_t *buf;
+    uint32_t buf_len;
+    uint32_t temp_fit = 0;
+    uint32_t other_fit = 0;
+    int ret = cqe->result;
+
+    if (ret < 0)
+    {
+        LOG_WRN("%s read failed (%d)", dev->name, ret);
+        rtio_cqe_release(ctx, cqe);
+        return;
+    }
+    if (rtio_cqe_get_mempool_buffer(ctx, cqe, &buf, &buf_len) != 0)
+    {
+        rtio_cqe_release(ctx, cqe);
+        return;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        struct hx_sample *s = &first[i];
+
+#if HAS_BMP
+        if (dev == bmp_dev)
+        {
+#if !HAS_SHT
+            (void)decode_next(dev, buf, SENSOR_CHAN_AMBIENT_TEMP, &temp_fit, &s->temp_mc);    // else SHT45 owns temperature
+#endif
+            (void)decode_next(dev, buf, SENSOR_CHAN_PRESS, &other_fit, &s->press_pa);
+        }
+#endif
+#if HAS_SHT
+        if (dev == sht_dev)
+        {
+            /* single-shot part, the one reading applies to the whole span */
+            uint32_t t_fit = 0;
+            uint32_t h_fit = 0;
+            (void)decode_next(dev, buf, SENSOR_CHAN_AMBIENT_TEMP, &t_fit, &s->temp_mc);
+            (void)decode_next(dev, buf, SENSOR_CHAN_HUMIDITY, &h_fit, &s->rh_mpct);
+        }
+#endif
+    }
+
+    rtio_release_buffer(ctx, buf, buf_len);
+    rtio_cqe_release(ctx, cqe);
+}
+
+
+#if SHARES_HX_BUS
+/* HX bus held with the sensors' mux channel routed, false (bus released) if the select failed */
+static bool bus_take(void)
+{
+    int ret;
+
+    hx_bus_lock(HX_CLIENT_SENSORS);
+    ret = hx_mux_select(hx_mux_channel(HX_CLIENT_SENSORS));
+    if (ret != 0)
+    {
+        hx_bus_unlock();
+        LOG_WRN("Sensor mux channel not selected (%d)", ret);
+        return false;
+    }
+    return true;
+}
+#endif
+
+
+#if HAS_SHT
+static void read_sht(struct hx_sample *first, uint16_t count)
+{
+    struct rtio_cqe *cqe;
+
+#if SHARES_HX_BUS
+    if (!bus_take())
+    {
+        return;
+    }
+#endif
+    if (sensor_read_async_mempool(&sht_iodev, &hx_rtio, (void *)sht_dev) != 0)
+    {
+#if SHARES_HX_BUS
+        hx_bus_unlock();
+#endif
+        return;
+    }
+    cqe = rtio_cqe_consume_block(&hx_rtio);
+#if SHARES_HX_BUS
+    hx_bus_unlock();
+#endif
+    process_cqe(&hx_rtio, cqe, first, count);
+}
+#endif
+
+
+#if defined(CONFIG_HX_SENSORS_BMP581_FIFO)
+
+static void sampler_run(void)
+{
+    const struct sensor_decoder_api *decoder;
+    struct rtio_sqe *handle;
+    struct sensor_value odr;
+
+    sensor_value_from_milli(&odr, 1000000 / CONFIG_HX_SENSORS_SAMPLE_PERIOD_MS);
+    if (sensor_attr_set(bmp_dev, SENSOR_CHAN_ALL, SENSOR_ATTR_SAMPLING_FREQUENCY, &odr) != 0)
+    {
+        LOG_WRN("BMP581 ODR not applied, using driver default");
+    }
+    if (sensor_get_decoder(bmp_dev, &decoder) != 0 ||
+        sensor_stream(&bmp_stream, &hx_stream_rtio, (void *)bmp_dev, &handle) != 0)
+    {
+        LOG_ERR("BMP581 FIFO stream unavailable");
+        return;
+    }
+
+    while (1)
+    {
+        struct rtio_cqe *cqe = rtio_cqe_consume_block(&hx_stream_rtio);    // one wake per watermark
+        uint32_t now = k_cycle_get_32();
+        uint32_t period = k_ms_to_cyc_floor32(CONFIG_HX_SENSORS_SAMPLE_PERIOD_MS);
+        struct hx_slot *slot;
+        uint16_t frames = 0;
+        uint8_t *buf = NULL;
+        uint32_t buf_len = 0;
+
+        if (cqe->result >= 0 && rtio_cqe_get_mempool_buffer(&hx_stream_rtio, cqe, &buf, &buf_len) == 0)
+        {
+            (void)decoder->get_frame_count(buf, (struct sensor_chan_spec){SENSOR_CHAN_PRESS, 0}, &frames);
+        }
+        if (frames == 0)
+        {
+            if (buf != NULL)
+            {
+                rtio_release_buffer(&hx_stream_rtio, buf, buf_len);
+            }
+            rtio_cqe_release(&hx_stream_rtio, cqe);
+            continue;
+        }
+        if (frames > BATCH_SIZE)
+        {
+            LOG_WRN("FIFO held %u frames, keeping first %u", frames, BATCH_SIZE);
+            frames = BATCH_SIZE;
+        }
+
+        slot = slot_claim();
+
+        memset(slot->samples, 0, frames * sizeof(struct hx_sample));
+        for (uint16_t i = 0; i < frames; i++)
+        {
+            slot->samples[i].cycles = now - (frames - 1 - i) * period;
+        }
+        process_cqe(&hx_stream_rtio, cqe, slot->samples, frames);
+#if HAS_SHT
+        read_sht(slot->samples, frames);
+#endif
+        slot->count = frames;
+        slot_publish(slot);
+    }
+}
+
+#else
+
+static void sampler_run(void)
+{
+    struct hx_slot *slot = NULL;
+    int64_t next = k_uptime_get();
+    static struct wake_source wake = { .name = "hx_sensors" };
+
+    wake_align_register(&wake);
+
+    while (1)
+    {
+        struct hx_sample *s;
+        int submitted = 0;
+        int ret;
+
+        if (slot == NULL)
+        {
+            slot = slot_claim();
+        }
+        s = &slot->samples[slot->count];
+        memset(s, 0, sizeof(*s));
+        s->cycles = k_cycle_get_32();
+
+        /* both parts in one chained submission, one bus burst per period */
+#if HAS_BMP
+        struct rtio_sqe *bmp_sqe = rtio_sqe_acquire(&hx_rtio);
+        if (bmp_sqe != NULL)
+        {
+            rtio_sqe_prep_read_with_pool(bmp_sqe, &bmp_iodev, RTIO_PRIO_NORM, (void *)bmp_dev);
+            submitted++;
+        }
+#endif
+#if HAS_SHT
+        struct rtio_sqe *sht_sqe = rtio_sqe_acquire(&hx_rtio);
+        if (sht_sqe != NULL)
+        {
+#if HAS_BMP
+            if (bmp_sqe != NULL)
+            {
+                bmp_sqe->flags |= RTIO_SQE_CHAINED;
+            }
+#endif
+            rtio_sqe_prep_read_with_pool(sht_sqe, &sht_iodev, RTIO_PRIO_NORM, (void *)sht_dev);
+            submitted++;
+        }
+#endif
+#if SHARES_HX_BUS
+        if (bus_take())
+        {
+            ret = rtio_submit(&hx_rtio, submitted);
+            hx_bus_unlock();
+        }
+        else
+        {
+            rtio_sqe_drop_all(&hx_rtio);                // this period's sample stays empty
+            ret = -EIO;
+        }
+#else
+        ret = rtio_submit(&hx_rtio, submitted);
+#endif
+        if (ret == 0)
+        {
+            for (int i = 0; i < submitted; i++)
+            {
+                process_cqe(&hx_rtio, rtio_cqe_consume_block(&hx_rtio), s, 1);
+            }
+        }
+
+        if (++slot->count == BATCH_SIZE)
+        {
+            slot_publish(slot);
+            slot = NULL;
+        }
+
+        next += CONFIG_HX_SENSORS_SAMPLE_PERIOD_MS;
+        wake_align_note(&wake, k_ms_to_ticks_ceil64(next), k_ms_to_ticks_ceil64(CONFIG_HX_SENSORS_SAMPLE_PERIOD_MS));
+        k_sleep(K_TIMEOUT_ABS_MS(next));
+    }
+}
+
+#endif /* CONFIG_HX_SENSORS_BMP581_FIFO */
+
+
+static void sampler_thread(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    ring_buf_init(&hx_ring, sizeof(ring_storage), (uint8_t *)ring_storage);
+
+#if HAS_BMP
+    if (hx_init_wait(bmp_dev, K_FOREVER) != 0)
+    {
+        LOG_ERR("BMP581 not ready");
+        return;
+    }
+#endif
+#if HAS_SHT
+    if (hx_init_wait(sht_dev, K_FOREVER) != 0)
+    {
+        LOG_ERR("SHT45 not ready");
+        return;
+    }
+#endif
+
+    LOG_INF("Sampling every %d ms, %d samples/batch", CONFIG_HX_SENSORS_SAMPLE_PERIOD_MS, BATCH_SIZE);
+    sampler_run();
+}
+
+K_THREAD_DEFINE(hx_sampler, 1536, sampler_thread, NULL, NULL, NULL, CONFIG_HX_SENSORS_THREAD_PRIORITY, 0, 0);
+
+
+int hx_sensors_batch_get(struct hx_batch *batch, k_timeout_t timeout)
+{
+    uint8_t *data;
+    const struct hx_slot *slot;
+
+    if (k_sem_take(&batch_ready, timeout) != 0)
+    {
+        return -EAGAIN;
+    }
+    (void)ring_buf_get_claim(&hx_ring, &data, sizeof(struct hx_slot));     // slots never straddle the wrap
+    slot = (const struct hx_slot *)data;
+
+    batch->seq = slot->seq;
+    batch->count = slot->count;
+    batch->samples = slot->samples;
+    return 0;
+}
+
+
+void hx_sensors_batch_release(const struct hx_batch *batch)
+{
+    ARG_UNUSED(batch);
+    ring_buf_get_finish(&hx_ring, sizeof(struct hx_slot));
+}
+
+
+uint32_t hx_sensors_overruns(void)
+{
+    return overruns;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HX_SENSORS_H_
+#define HX_SENSORS_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+/* One decoded Sensor-1 sample. Fields a fitted part does not provide read 0. */
+struct hx_sample {
+    uint32_t cycles;        /* k_cycle_get_32() timestamp of the sample */
+    int32_t temp_mc;        /* temperature, milli-degC (SHT45 if fitted, else BMP581) */
+    int32_t press_pa;       /* pressure, Pa */
+    int32_t rh_mpct;        /* relative humidity, milli-% */
+};
+
+/* A batch borrowed from the sampler ring; samples point into ring storage. */
+struct hx_batch {
+    uint32_t seq;
+    uint16_t count;
+    const struct hx_sample *samples;
+};
+
+/**
+ * Wait for the next complete batch. The batch stays valid (and its ring slot
+ * stays claimed) until hx_sensors_batch_release() is called.
+ *
+ * @return 0 on success, -EAGAIN on timeout
+ */
+int hx_sensors_batch_get(struct hx_batch *batch, k_timeout_t timeout);
+
+/** Return a batch slot to the sampler. */
+void hx_sensors_batch_release(const struct hx_batch *batch);
+
+/** Count of batches dropped because no consumer freed a ring slot in time. */
+uint32_t hx_sensors_overruns(void);
+
+#endif /* HX_SENSORS_H_ */
@@ -0,0 +1,806 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Indicator worker. Patterns are const step tables played by a delayable work
+ * item on a dedicated work queue, so callers (including ISRs) only swap a
+ * pointer and kick the worker; all bus traffic happens on the worker thread.
+ *
+ * With CONFIG_INDICATOR_RETAIN the pattern, its position and the color on the
+ * LED are kept in no-init RAM. An early hook restores them after a reset,
+ * leaving the chip alone when it kept its state, and the worker resumes the
+ * pattern where it was. A stopped or finished pattern is kept as the color it
+ * left on the LED, and an engine blink as its color and times.
+ *
+ * With CONFIG_INDICATOR_EDF, requests that carry a deadline are kept apart from
+ * the single latest-wins request slot and served earliest deadline first; a
+ * pattern started that way plays once through before a request without a
+ * deadline may replace it.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(indicator, LOG_LEVEL_INF);
+
+#include <rgb_indicator.h>
+#include "indicator.h"
+#include "indicator_backend.h"
+#include "wake_align.h"
+#include "brightness.h"
+#include "indicator_mgmt.h"
+#include "indicator_sync.h"
+#include "indicator_health.h"
+
+INDICATOR_PATTERN(indicator_pattern_motion, 3,
+    { RGB(0, 0, 100), 150 },
+    { RGB(0, 0, 0), 150 });
+
+INDICATOR_PATTERN(indicator_pattern_tap, 1,
+    { RGB(100, 100, 100), 80 },
+    { RGB(0, 0, 0), 0 });
+
+INDICATOR_PATTERN(indicator_pattern_boot, 0,
+    { RGB(30, 30, 30), 250 },
+    { RGB(0, 0, 30), 250 });
+
+K_THREAD_STACK_DEFINE(indicator_stack, CONFIG_INDICATOR_STACK_SIZE);
+static struct k_work_q indicator_q;
+static struct k_work_delayable step_work;
+static struct k_work refresh_work;
+#if defined(CONFIG_INDICATOR_HEALTH)
+static struct k_work_delayable heartbeat_work;
+#endif
+static struct k_spinlock lock;
+
+/* color last written, before gamma/brightness; only touched on the worker */
+static struct led_rgb shown;
+static bool blinking;
+
+static struct indicator_step solid_step;
+static const struct indicator_pattern solid = { .name = "solid", .steps = &solid_step, .count = 1, .repeat = 1 };
+
+/* request side, written under lock by callers */
+static const struct indicator_pattern *pending;
+static uint32_t pending_origin;
+static bool pending_valid;
+
+#if defined(CONFIG_INDICATOR_EDF)
+struct edf_request {
+    const struct indicator_pattern *pattern;
+    uint32_t origin;
+    uint32_t deadline;                          /* k_cycle_get_32() */
+    bool valid;
+};
+
+static struct edf_request edf[CONFIG_INDICATOR_EDF_SLOTS];
+static bool protect;                            // deadline pattern in its first pass, pending waits
+#endif
+
+/* worker side, only touched by step_handler */
+static struct {
+    const struct indicator_pattern *pattern;
+    uint8_t step;
+    uint8_t pass;
+    uint32_t origin;
+#if defined(CONFIG_INDICATOR_EDF)
+    uint32_t deadline;
+    bool timed;                                 /* deadline not checked yet */
+#endif
+#if defined(CONFIG_INDICATOR_HEALTH)
+    k_ticks_t due;                              /* uptime ticks the step timer was set for, 0 = none */
+#endif
+} run;
+
+static struct indicator_stats stats;
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+#define RETAINED_MAGIC 0x494e4431                   // "IND1"
+
+struct retained_state {
+    const struct indicator_pattern *pattern;        /* NULL: solid color */
+    struct led_rgb color;                           /* on the LED */
+    uint8_t step;                                   /* step being held */
+    uint8_t pass;
+    uint32_t on_ms;                                 /* engine blink when off_ms != 0 */
+    uint32_t off_ms;
+};
+
+static struct {
+    uint32_t magic;
+    struct retained_state state;
+    uint32_t crc;
+} retained __noinit;
+
+static bool restored;
+static bool resume;
+static bool restore_deferred;                       // chip still in deferred init, the worker writes it
+static struct k_work restore_work;
+#endif
+
+/* Shortest step the bus budget allows at the current HX clock */
+static uint32_t frame_min_us;
+
+
+void indicator_frame_rate_update(void)
+{
+    uint32_t frame_us = indicator_backend_frame_us();
+
+    frame_min_us = frame_us * 100 / CONFIG_INDICATOR_BUS_BUDGET_PCT;
+    if (frame_us != 0)
+    {
+        LOG_INF("%s frame %u us, max %u frames/s", indicator_backend_name(), frame_us, USEC_PER_SEC / frame_min_us);
+    }
+}
+
+
+/* Through the gamma/brightness stage to the backend */
+static int show(const struct led_rgb *color)
+{
+    struct led_rgb out = brightness_apply(color);
+    uint32_t start = k_cycle_get_32();
+    int ret = indicator_backend_set_color(&out);
+
+    indicator_mgmt_frame(&out, k_cycle_get_32() - start, ret);
+    if (ret == 0)
+    {
+        shown = *color;
+        blinking = false;
+    }
+    return ret;
+}
+
+
+static void refresh_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+    if (!blinking)
+    {
+        (void)show(&shown);
+    }
+}
+
+
+#if defined(CONFIG_INDICATOR_HEALTH)
+static atomic_t heartbeat_idle;                     // heartbeat stopped with the worker idle
+
+
+/*
+ * Fed from the worker itself, so a blocked worker stops feeding. With no
+ * pattern running and no step queued the watchdog channel is suspended and
+ * the heartbeat stops until the next request, so an idle LED costs no wakeups.
+ */
+static void heartbeat_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+    atomic_set(&heartbeat_idle, 1);                 // a request from here on restarts the heartbeat
+    if (run.pattern == NULL && !k_work_delayable_is_pending(&step_work))
+    {
+        indicator_health_suspend();
+        return;
+    }
+    atomic_set(&heartbeat_idle, 0);
+    indicator_health_resume();
+    indicator_health_feed();
+    k_work_reschedule_for_queue(&indicator_q, &heartbeat_work,
+                                wake_align_delay(CONFIG_INDICATOR_HEALTH_TIMEOUT_MS / 4 * USEC_PER_MSEC,
+                                                 CONFIG_INDICATOR_HEALTH_TIMEOUT_MS / 4));    // fed by half the timeout at worst
+}
+
+
+/* After queueing a request: wake the heartbeat if it stopped for idle */
+static void heartbeat_kick(void)
+{
+    if (atomic_cas(&heartbeat_idle, 1, 0))
+    {
+        k_work_reschedule_for_queue(&indicator_q, &heartbeat_work, K_NO_WAIT);
+    }
+}
+#else
+static inline void heartbeat_kick(void) { }
+#endif
+
+
+static void boot_mark(void)
+{
+    if (stats.boot_us == 0)
+    {
+        stats.boot_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+    }
+}
+
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+
+static void retained_commit(void)
+{
+    retained.magic = RETAINED_MAGIC;
+    retained.crc = crc32_ieee((const uint8_t *)&retained.state, sizeof(retained.state));
+}
+
+
+static void retained_store(const struct indicator_step *step)
+{
+    retained.state.pattern = run.pattern == &solid ? NULL : run.pattern;
+    retained.state.color = step->color;
+    retained.state.step = run.step;
+    retained.state.pass = run.pass;
+    retained.state.on_ms = 0;
+    retained.state.off_ms = 0;
+    retained_commit();
+}
+
+
+/* Nothing left to resume: stopped (off_ms 0) or handed to the engine */
+static void retained_store_held(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    retained.state.pattern = NULL;
+    retained.state.color = *color;
+    retained.state.step = 0;
+    retained.state.pass = 0;
+    retained.state.on_ms = on_ms;
+    retained.state.off_ms = off_ms;
+    retained_commit();
+}
+
+
+static bool retained_valid(void)
+{
+    if (retained.magic != RETAINED_MAGIC ||
+        retained.crc != crc32_ieee((const uint8_t *)&retained.state, sizeof(retained.state)))
+    {
+        return false;
+    }
+    if (retained.state.pattern == NULL)
+    {
+        return true;
+    }
+    STRUCT_SECTION_FOREACH(indicator_pattern, known)           // a new image may have moved the patterns
+    {
+        if (known == retained.state.pattern)
+        {
+            return retained.state.step < known->count;
+        }
+    }
+    return false;
+}
+
+#else
+static inline void retained_store(const struct indicator_step *step) { ARG_UNUSED(step); }
+static inline void retained_store_held(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    ARG_UNUSED(color);
+    ARG_UNUSED(on_ms);
+    ARG_UNUSED(off_ms);
+}
+#endif
+
+
+/* Past the step just shown: move on, finish, or wait out its hold */
+#if defined(CONFIG_INDICATOR_EDF)
+
+/* Under lock */
+static struct edf_request *edf_earliest(void)
+{
+    struct edf_request *first = NULL;
+
+    for (size_t i = 0; i < ARRAY_SIZE(edf); i++)
+    {
+        if (edf[i].valid && (first == NULL || (int32_t)(edf[i].deadline - first->deadline) < 0))
+        {
+            first = &edf[i];
+        }
+    }
+    return first;
+}
+
+
+/* End of a pass: lift the hold on pending requests, true if one is waiting */
+static bool pass_done(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool waiting = protect && pending_valid;
+
+    protect = false;
+    k_spin_unlock(&lock, key);
+    return waiting;
+}
+
+
+static void deadline_check(void)
+{
+    int32_t late = (int32_t)(k_cycle_get_32() - run.deadline);
+
+    run.timed = false;
+    if (late <= 0)
+    {
+        stats.deadline_met++;
+        return;
+    }
+    stats.deadline_missed++;
+    stats.late_max_us = MAX(stats.late_max_us, k_cyc_to_us_floor32(late));
+    indicator_mgmt_deadline_missed();
+    LOG_WRN("%s reached the LED %u us past its deadline", run.pattern->name, k_cyc_to_us_floor32(late));
+}
+
+#else
+
+static inline bool pass_done(void) { return false; }
+
+#endif /* CONFIG_INDICATOR_EDF */
+
+
+/* Under lock: move the next request to run, false if there is none to take now */
+static bool take_request(void)
+{
+#if defined(CONFIG_INDICATOR_EDF)
+    struct edf_request *req = edf_earliest();
+
+    if (req != NULL)
+    {
+        run.pattern = req->pattern;
+        run.origin = req->origin;
+        run.deadline = req->deadline;
+        run.timed = true;
+        run.step = 0;
+        run.pass = 0;
+        req->valid = false;
+        protect = true;
+        return true;
+    }
+    if (protect)
+    {
+        return false;
+    }
+    run.timed = false;
+#endif
+    if (!pending_valid)
+    {
+        return false;
+    }
+    run.pattern = pending;
+    run.origin = pending_origin;
+    run.step = 0;
+    run.pass = 0;
+    pending_valid = false;
+    return true;
+}
+
+
+#if defined(CONFIG_INDICATOR_SYNC)
+/* One pass as played, with every step at least the bus-budget minimum */
+static uint32_t pass_us(const struct indicator_pattern *pattern)
+{
+    uint32_t us = 0;
+
+    for (uint8_t i = 0; i < pattern->count; i++)
+    {
+        us += MAX(pattern->steps[i].hold_ms * USEC_PER_MSEC, frame_min_us);
+    }
+    return us;
+}
+#endif
+
+
+static void step_advance(const struct indicator_step *step)
+{
+    uint32_t hold_us = step->hold_ms * USEC_PER_MSEC;
+
+    if (++run.step == run.pattern->count)
+    {
+        bool waiting = pass_done();
+
+        run.step = 0;
+        if (run.pattern->repeat != 0 && ++run.pass >= run.pattern->repeat)
+        {
+            run.pattern = NULL;                 // done, LED holds the last step
+            retained_store_held(&step->color, 0, 0);
+            if (!waiting)
+            {
+                return;
+            }
+        }
+    }
+    if (hold_us < frame_min_us)
+    {
+        indicator_mgmt_throttled();
+        hold_us = frame_min_us;
+    }
+#if defined(CONFIG_INDICATOR_SYNC)
+    if (run.step == 0 && run.pattern != NULL)
+    {
+        /* next step starts a pass: on the sync grid, not wake-aligned, never under the bus budget */
+        k_work_reschedule_for_queue(&indicator_q, &step_work,
+                                    K_USEC(MAX(indicator_sync_align_us(hold_us, pass_us(run.pattern)),
+                                               frame_min_us)));
+        return;
+    }
+#endif
+    k_work_reschedule_for_queue(&indicator_q, &step_work, wake_align_delay(hold_us, step->slack_ms));
+}
+
+
+static void step_handler(struct k_work *work)
+{
+    struct indicator_step step;
+    k_spinlock_key_t key;
+    bool taken;
+    int ret;
+
+    ARG_UNUSED(work);
+
+#if defined(CONFIG_INDICATOR_HEALTH)
+    if (run.due != 0 && k_uptime_ticks() > run.due)
+    {
+        indicator_health_tick(k_ticks_to_ms_floor32(k_uptime_ticks() - run.due));
+    }
+    run.due = 0;
+#endif
+    key = k_spin_lock(&lock);
+    taken = take_request();
+    if (run.pattern == NULL)
+    {
+        k_spin_unlock(&lock, key);
+        if (taken && !blinking)
+        {
+            retained_store_held(&shown, 0, 0);          // stopped, the LED keeps what it shows
+        }
+        return;
+    }
+    step = run.pattern->steps[run.step];       // copy, solid_step may be rewritten by a caller
+    k_spin_unlock(&lock, key);
+
+    ret = show(&step.color);
+    if (ret != 0)
+    {
+        stats.errors++;
+        LOG_WRN("Step %u of %s failed (%d)", run.step, run.pattern->name, ret);
+    }
+    else
+    {
+        stats.writes++;
+        boot_mark();
+        retained_store(&step);
+    }
+
+    if (run.origin != 0)
+    {
+        stats.lat_last_us = k_cyc_to_us_floor32(k_cycle_get_32() - run.origin);
+        stats.lat_max_us = MAX(stats.lat_max_us, stats.lat_last_us);
+        indicator_mgmt_latency(stats.lat_last_us);
+        run.origin = 0;
+    }
+#if defined(CONFIG_INDICATOR_EDF)
+    if (run.timed)
+    {
+        deadline_check();
+    }
+#endif
+    step_advance(&step);
+#if defined(CONFIG_INDICATOR_HEALTH)
+    if (k_work_delayable_is_pending(&step_work))
+    {
+        run.due = k_uptime_ticks() + k_work_delayable_remaining_get(&step_work);
+    }
+#endif
+#if defined(CONFIG_INDICATOR_EDF)
+    key = k_spin_lock(&lock);
+    if (edf_earliest() != NULL)
+    {
+        k_work_reschedule_for_queue(&indicator_q, &step_work, K_NO_WAIT);   // more deadline work queued
+    }
+    k_spin_unlock(&lock, key);
+#endif
+}
+
+
+const struct indicator_pattern *indicator_pattern_find(const char *name)
+{
+    STRUCT_SECTION_FOREACH(indicator_pattern, p)
+    {
+        if (strcmp(p->name, name) == 0)
+        {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+
+void indicator_play_from(const struct indicator_pattern *pattern, uint32_t origin_cycles)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool held = false;
+
+    if (pending_valid)
+    {
+        indicator_mgmt_coalesced();             // the worker never showed the one before
+    }
+    pending = pattern;
+    pending_origin = origin_cycles == 0 ? 1 : origin_cycles;     // 0 means "not measured"
+    pending_valid = true;
+    stats.plays++;
+#if defined(CONFIG_INDICATOR_EDF)
+    held = protect;                             // picked up when the deadline pattern's pass ends
+#endif
+    k_spin_unlock(&lock, key);
+
+    if (!held)
+    {
+        k_work_reschedule_for_queue(&indicator_q, &step_work, K_NO_WAIT);
+    }
+    heartbeat_kick();
+}
+
+
+#if defined(CONFIG_INDICATOR_EDF)
+void indicator_play_by(const struct indicator_pattern *pattern, uint32_t origin_cycles, uint32_t within_ms)
+{
+    uint32_t deadline = origin_cycles + (uint32_t)k_ms_to_cyc_ceil64(within_ms);
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    struct edf_request *slot = NULL;
+
+    for (size_t i = 0; i < ARRAY_SIZE(edf); i++)
+    {
+        if (!edf[i].valid)
+        {
+            slot = &edf[i];
+            break;
+        }
+        if (slot == NULL || (int32_t)(edf[i].deadline - slot->deadline) > 0)
+        {
+            slot = &edf[i];                     // full: the latest deadline makes way
+        }
+    }
+    if (slot->valid && (int32_t)(slot->deadline - deadline) <= 0)
+    {
+        stats.deadline_dropped++;               // every queued request is more urgent
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    if (slot->valid)
+    {
+        stats.deadline_dropped++;
+    }
+    slot->pattern = pattern;
+    slot->origin = origin_cycles == 0 ? 1 : origin_cycles;
+    slot->deadline = deadline;
+    slot->valid = true;
+    stats.plays++;
+    k_spin_unlock(&lock, key);
+
+    k_work_reschedule_for_queue(&indicator_q, &step_work, K_NO_WAIT);
+    heartbeat_kick();
+}
+#endif
+
+
+void indicator_set_color_from(const struct led_rgb *color, uint32_t origin_cycles)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    solid_step.color = *color;
+    k_spin_unlock(&lock, key);
+
+    indicator_play_from(&solid, origin_cycles);
+}
+
+
+void indicator_stop(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    pending = NULL;
+    pending_origin = 0;
+    pending_valid = true;
+#if defined(CONFIG_INDICATOR_EDF)
+    for (size_t i = 0; i < ARRAY_SIZE(edf); i++)
+    {
+        edf[i].valid = false;
+    }
+    protect = false;
+#endif
+    k_spin_unlock(&lock, key);
+
+    k_work_reschedule_for_queue(&indicator_q, &step_work, K_NO_WAIT);
+    heartbeat_kick();
+}
+
+
+int indicator_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    struct k_work_sync sync;
+    struct led_rgb out = brightness_apply(color);
+    int ret;
+
+    indicator_stop();
+    k_work_flush_delayable(&step_work, &sync);          // no software step may land on top of the engine
+    ret = indicator_backend_blink(&out, on_ms, off_ms);
+    blinking = ret == 0;
+    if (blinking)
+    {
+        shown = *color;
+        retained_store_held(color, on_ms, off_ms);
+    }
+    return ret;
+}
+
+
+void indicator_refresh(void)
+{
+    k_work_submit_to_queue(&indicator_q, &refresh_work);
+}
+
+
+void indicator_stats_get(struct indicator_stats *out)
+{
+    *out = stats;
+}
+
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+/* Put the retained color or engine blink back, *kept if the chip still showed it */
+static int restore_output(bool *kept)
+{
+    const struct retained_state *s = &retained.state;
+    struct led_rgb out = brightness_apply(&s->color);
+    int ret;
+
+    *kept = false;
+    if (s->off_ms != 0)
+    {
+        ret = indicator_backend_blink(&out, s->on_ms, s->off_ms);     // restart the engine, its phase is lost anyway
+        blinking = ret == 0;
+        return ret;
+    }
+    *kept = indicator_backend_holds(&out);
+    return *kept ? 0 : show(&s->color);
+}
+
+
+/* The restore write the early hook could not make without waiting on the chip */
+static void restore_handler(struct k_work *work)
+{
+    bool kept;
+    int ret;
+
+    ARG_UNUSED(work);
+    ret = restore_output(&kept);
+    if (ret != 0)
+    {
+        stats.errors++;
+        LOG_WRN("Restore write failed (%d)", ret);
+        return;
+    }
+    boot_mark();
+    if (resume)
+    {
+        step_advance(&run.pattern->steps[run.step]);
+    }
+}
+#endif
+
+
+static int indicator_init(void)
+{
+    k_work_init_delayable(&step_work, step_handler);
+    k_work_init(&refresh_work, refresh_handler);
+#if defined(CONFIG_INDICATOR_HEALTH)
+    k_work_init_delayable(&heartbeat_work, heartbeat_handler);
+#endif
+    k_work_queue_start(&indicator_q, indicator_stack, K_THREAD_STACK_SIZEOF(indicator_stack),
+                       CONFIG_INDICATOR_THREAD_PRIORITY, NULL);
+    k_thread_name_set(&indicator_q.thread, "indicator");
+#if defined(CONFIG_INDICATOR_HEALTH)
+    k_work_reschedule_for_queue(&indicator_q, &heartbeat_work, K_NO_WAIT);
+#endif
+
+    if (indicator_backend_select() != 0)
+    {
+        LOG_ERR("No indicator backend ready");
+        return -ENODEV;
+    }
+    indicator_frame_rate_update();
+    LOG_INF("Indicator on %s", indicator_backend_name());
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+    k_work_init(&restore_work, restore_handler);
+    if (restore_deferred)
+    {
+        k_work_submit_to_queue(&indicator_q, &restore_work);   // resumes the pattern once written
+        return 0;
+    }
+    if (resume)
+    {
+        step_advance(&run.pattern->steps[run.step]);    // the restored step gets a fresh hold
+        return 0;
+    }
+#endif
+#if defined(CONFIG_INDICATOR_EARLY)
+    if (!indicator_restored())
+    {
+        run.pattern = &indicator_pattern_boot;
+        if (indicator_backend_ready())
+        {
+            step_handler(&step_work.work);              // first step written right here, not when the worker gets the CPU
+            LOG_INF("Boot pattern %u us after reset", stats.boot_us);
+        }
+        else
+        {
+            k_work_reschedule_for_queue(&indicator_q, &step_work, K_NO_WAIT);   // after the deferred chip init
+        }
+    }
+#endif
+    return 0;
+}
+
+#if defined(CONFIG_INDICATOR_EARLY)
+SYS_INIT(indicator_init, POST_KERNEL, CONFIG_INDICATOR_INIT_PRIORITY);
+#else
+SYS_INIT(indicator_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+BUILD_ASSERT(CONFIG_INDICATOR_CLIENT_INIT_PRIORITY > CONFIG_APPLICATION_INIT_PRIORITY,
+             "indicator clients must init after the indicator");
+#endif
+
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+
+bool indicator_restored(void)
+{
+    return restored;
+}
+
+
+/* Runs as soon as the bus and driver are up, well before the application */
+static int indicator_restore(void)
+{
+    const struct retained_state *s = &retained.state;
+    bool kept = false;
+
+    if (!retained_valid() || indicator_backend_select() != 0)
+    {
+        return 0;
+    }
+
+    if (indicator_backend_ready())
+    {
+        if (restore_output(&kept) != 0)
+        {
+            return 0;
+        }
+        boot_mark();
+    }
+    else
+    {
+        restore_deferred = true;                        // a write now would block boot on the deferred chip init
+    }
+    shown = s->color;
+    restored = true;
+
+    if (s->pattern != NULL)
+    {
+        run.pattern = s->pattern;
+        run.step = s->step;
+        run.pass = s->pass;
+        resume = true;
+    }
+    else
+    {
+        solid_step.color = s->color;
+    }
+    LOG_INF("Restored %s step %u, %s, %u us after reset",
+            s->off_ms != 0 ? "blink" : s->pattern != NULL ? s->pattern->name : "solid", s->step,
+            restore_deferred ? "written after chip init" : kept ? "chip kept its state" : "rewritten",
+            stats.boot_us);
+    return 0;
+}
+
+SYS_INIT(indicator_restore, POST_KERNEL, CONFIG_INDICATOR_RETAIN_INIT_PRIORITY);
+
+#endif /* CONFIG_INDICATOR_RETAIN */
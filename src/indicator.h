@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_H_
+#define INDICATOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <rgb_indicator.h>
+
+struct indicator_step {
+    struct led_rgb color;
+    uint16_t hold_ms;
+    uint16_t slack_ms;          /* may end up to this much late to share a wakeup (CONFIG_WAKE_ALIGN) */
+};
+
+struct indicator_pattern {
+    const char *name;
+    const struct indicator_step *steps;
+    uint8_t count;
+    uint8_t repeat;             /* passes through steps, 0 = until replaced */
+};
+
+/* Patterns live in an iterable ROM section, so they can be found by name or validated by address */
+#define INDICATOR_PATTERN(_name, _repeat, ...)                                      \
+    static const struct indicator_step _name##_steps[] = { __VA_ARGS__ };          \
+    const STRUCT_SECTION_ITERABLE(indicator_pattern, _name) = {                     \
+        .name = #_name, .steps = _name##_steps,                                     \
+        .count = ARRAY_SIZE(_name##_steps), .repeat = (_repeat) }
+
+struct indicator_stats {
+    uint32_t plays;
+    uint32_t writes;
+    uint32_t errors;
+    uint32_t lat_last_us;       /* request origin to first LED write */
+    uint32_t lat_max_us;
+    uint32_t boot_us;           /* reset to the first correct LED state */
+    uint32_t deadline_met;      /* deadline requests, first write in time */
+    uint32_t deadline_missed;
+    uint32_t deadline_dropped;  /* pushed out of a full queue by more urgent ones */
+    uint32_t late_max_us;       /* worst miss */
+};
+
+/* Built-in patterns */
+extern const struct indicator_pattern indicator_pattern_motion;
+extern const struct indicator_pattern indicator_pattern_tap;
+extern const struct indicator_pattern indicator_pattern_boot;
+
+/** Look a pattern up by name, NULL if there is none. */
+const struct indicator_pattern *indicator_pattern_find(const char *name);
+
+/**
+ * Start a pattern, replacing whatever is playing. Safe from ISR context.
+ * Latency is measured from origin_cycles (a k_cycle_get_32() stamp taken where
+ * the triggering event was first seen) to the first LED write.
+ */
+void indicator_play_from(const struct indicator_pattern *pattern, uint32_t origin_cycles);
+
+static inline void indicator_play(const struct indicator_pattern *pattern)
+{
+    indicator_play_from(pattern, k_cycle_get_32());
+}
+
+#if defined(CONFIG_INDICATOR_EDF)
+/**
+ * Start a pattern whose first step must reach the LED within within_ms of
+ * origin_cycles. Pending deadline requests are served earliest deadline first,
+ * ahead of plain requests, and the pattern plays once through before a plain
+ * request may replace it. Misses are counted and logged. Safe from ISR context.
+ */
+void indicator_play_by(const struct indicator_pattern *pattern, uint32_t origin_cycles, uint32_t within_ms);
+#else
+static inline void indicator_play_by(const struct indicator_pattern *pattern, uint32_t origin_cycles,
+                                     uint32_t within_ms)
+{
+    ARG_UNUSED(within_ms);
+    indicator_play_from(pattern, origin_cycles);
+}
+#endif
+
+/** Show a solid color, replacing whatever is playing, latency measured from origin_cycles. Safe from ISR context. */
+void indicator_set_color_from(const struct led_rgb *color, uint32_t origin_cycles);
+
+static inline void indicator_set_color(const struct led_rgb *color)
+{
+    indicator_set_color_from(color, k_cycle_get_32());
+}
+
+/** Stop the current pattern, leaving the LED at its last color. */
+void indicator_stop(void);
+
+/**
+ * Blink a color in hardware (the LP5817 engine), replacing whatever is playing.
+ * The timing is rounded to what the engine can hold. Thread context only.
+ *
+ * @retval -ENOTSUP the active backend cannot blink by itself.
+ */
+int indicator_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms);
+
+#if defined(CONFIG_INDICATOR_RETAIN)
+/** True when the pre-reset pattern was restored (or found still showing) at boot. */
+bool indicator_restored(void);
+#else
+static inline bool indicator_restored(void) { return false; }
+#endif
+
+/** Rewrite the current color, e.g. after the brightness stage changed. Safe from ISR context. */
+void indicator_refresh(void);
+
+void indicator_stats_get(struct indicator_stats *stats);
+
+/** Re-derive the step rate cap after the HX bus clock changes. */
+void indicator_frame_rate_update(void);
+
+#endif /* INDICATOR_H_ */
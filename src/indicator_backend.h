@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Indicator output backends. With one backend configured the calls below
+ * resolve straight to that backend's functions; the vtable only exists (and
+ * is picked at boot) when both are built in.
+ */
+
+#ifndef INDICATOR_BACKEND_H_
+#define INDICATOR_BACKEND_H_
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <rgb_indicator.h>
+
+struct indicator_backend {
+    const char *name;
+    int (*init)(void);
+    int (*set_color)(const struct led_rgb *color);
+    uint32_t (*frame_us)(void);         /* wire/setup time of one color update, 0 if negligible */
+    int (*blink)(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms);     /* NULL: no hardware blink */
+    bool (*holds)(const struct led_rgb *color);     /* output survived the reset showing color; NULL: never */
+    bool (*ready)(void);                            /* a write now would not wait on deferred init; NULL: always */
+    int (*dim)(uint16_t scale);                     /* hardware output scale, Q8; NULL: none */
+    uint16_t (*dim_min)(void);                      /* smallest scale dim() resolves well */
+};
+
+#if defined(CONFIG_INDICATOR_BACKEND_LP5817)
+int lp5817_backend_init(void);
+int lp5817_backend_set_color(const struct led_rgb *color);
+uint32_t lp5817_backend_frame_us(void);
+int lp5817_backend_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms);
+bool lp5817_backend_holds(const struct led_rgb *color);
+bool lp5817_backend_ready(void);
+int lp5817_backend_dim(uint16_t scale);
+uint16_t lp5817_backend_dim_min(void);
+extern const struct indicator_backend indicator_backend_lp5817;
+#endif
+
+#if defined(CONFIG_INDICATOR_BACKEND_PWM)
+int pwm_backend_init(void);
+int pwm_backend_set_color(const struct led_rgb *color);
+uint32_t pwm_backend_frame_us(void);
+extern const struct indicator_backend indicator_backend_pwm;
+#endif
+
+
+#if defined(CONFIG_INDICATOR_BACKEND_LP5817) && defined(CONFIG_INDICATOR_BACKEND_PWM)
+
+/* Both built in: chosen by indicator_backend_select() at boot */
+extern const struct indicator_backend *indicator_backend;
+
+int indicator_backend_select(void);
+
+static inline int indicator_backend_set_color(const struct led_rgb *color) { return indicator_backend->set_color(color); }
+static inline uint32_t indicator_backend_frame_us(void) { return indicator_backend->frame_us(); }
+static inline const char *indicator_backend_name(void) { return indicator_backend->name; }
+static inline int indicator_backend_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    return indicator_backend->blink != NULL ? indicator_backend->blink(color, on_ms, off_ms) : -ENOTSUP;
+}
+static inline bool indicator_backend_holds(const struct led_rgb *color)
+{
+    return indicator_backend->holds != NULL && indicator_backend->holds(color);
+}
+static inline bool indicator_backend_ready(void)
+{
+    return indicator_backend->ready == NULL || indicator_backend->ready();
+}
+static inline int indicator_backend_dim(uint16_t scale)
+{
+    return indicator_backend->dim != NULL ? indicator_backend->dim(scale) : -ENOTSUP;
+}
+static inline uint16_t indicator_backend_dim_min(void)
+{
+    return indicator_backend->dim_min != NULL ? indicator_backend->dim_min() : 256;
+}
+
+#elif defined(CONFIG_INDICATOR_BACKEND_LP5817)
+
+static inline int indicator_backend_select(void) { return lp5817_backend_init(); }
+static inline int indicator_backend_set_color(const struct led_rgb *color) { return lp5817_backend_set_color(color); }
+static inline uint32_t indicator_backend_frame_us(void) { return lp5817_backend_frame_us(); }
+static inline const char *indicator_backend_name(void) { return "lp5817"; }
+static inline int indicator_backend_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    return lp5817_backend_blink(color, on_ms, off_ms);
+}
+static inline bool indicator_backend_holds(const struct led_rgb *color) { return lp5817_backend_holds(color); }
+static inline bool indicator_backend_ready(void) { return lp5817_backend_ready(); }
+static inline int indicator_backend_dim(uint16_t scale) { return lp5817_backend_dim(scale); }
+static inline uint16_t indicator_backend_dim_min(void) { return lp5817_backend_dim_min(); }
+
+#elif defined(CONFIG_INDICATOR_BACKEND_PWM)
+
+static inline int indicator_backend_select(void) { return pwm_backend_init(); }
+static inline int indicator_backend_set_color(const struct led_rgb *color) { return pwm_backend_set_color(color); }
+static inline uint32_t indicator_backend_frame_us(void) { return pwm_backend_frame_us(); }
+static inline const char *indicator_backend_name(void) { return "pwm"; }
+static inline int indicator_backend_blink(const struct led_rgb *color, uint32_t on_ms, uint32_t off_ms)
+{
+    ARG_UNUSED(color);
+    ARG_UNUSED(on_ms);
+    ARG_UNUSED(off_ms);
+    return -ENOTSUP;
+}
+static inline bool indicator_backend_holds(const struct led_rgb *color)
+{
+    ARG_UNUSED(color);
+    return false;                       // PWM peripheral is reset with the CPU
+}
+static inline bool indicator_backend_ready(void) { return true; }
+static inline int indicator_backend_dim(uint16_t scale)
+{
+    ARG_UNUSED(scale);
+    return -ENOTSUP;
+}
+static inline uint16_t indicator_backend_dim_min(void) { return 256; }      // nothing to dim with
+
+#else
+#error "CONFIG_INDICATOR needs CONFIG_INDICATOR_BACKEND_LP5817 or CONFIG_INDICATOR_BACKEND_PWM"
+#endif
+
+#endif /* INDICATOR_BACKEND_H_ */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Indicator pipeline health. The indicator worker feeds a task watchdog
+ * channel from a heartbeat on its own queue, so a worker blocked anywhere (a
+ * hung HX bus transfer, typically) stops the feeds. On expiry, recovery runs on
+ * the system work queue: the bus is cleared out from under the stuck
+ * transfer, the LP5817 is rewritten from the shadow registers (the bus restore
+ * hooks), and the worker is asked to re-show the current step, after which the
+ * pattern carries on from where it stalled. The time from detection to the
+ * worker's next feed is the recovery time. After
+ * CONFIG_INDICATOR_HEALTH_MAX_RECOVERIES expiries in a row the board is warm
+ * rebooted; with CONFIG_INDICATOR_RETAIN the pattern survives that too.
+ *
+ * Steps that run well after they were due are counted as missed ticks, an
+ * early sign of a starved or slow worker. While the worker is idle its channel
+ * is taken out of the task watchdog, so neither side has to wake up to feed.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/reboot.h>
+#include <zephyr/task_wdt/task_wdt.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(indicator_health, LOG_LEVEL_INF);
+
+#include "indicator_health.h"
+#include "indicator.h"
+#include "hx_bus.h"
+
+static int channel = -1;
+static bool suspended;                              // channel left out until the worker has work
+static atomic_t recovering;
+static uint32_t stalled_at;
+static atomic_t in_a_row;                           // expiries without a feed in between
+static struct indicator_health_stats stats;
+static struct k_work recover_work;
+
+
+void indicator_health_feed(void)
+{
+    uint32_t us;
+
+    if (channel < 0)
+    {
+        return;
+    }
+    (void)task_wdt_feed(channel);
+    if (!atomic_cas(&recovering, 1, 0))
+    {
+        return;
+    }
+    us = k_cyc_to_us_floor32(k_cycle_get_32() - stalled_at);
+    stats.recovered++;
+    stats.recovery_last_us = us;
+    stats.recovery_max_us = MAX(stats.recovery_max_us, us);
+    atomic_set(&in_a_row, 0);
+    LOG_INF("Indicator recovered %u us after the stall was detected", us);
+}
+
+
+void indicator_health_tick(uint32_t late_ms)
+{
+    if (late_ms <= CONFIG_INDICATOR_HEALTH_LATE_MS)
+    {
+        return;
+    }
+    stats.missed_ticks++;
+    stats.late_max_ms = MAX(stats.late_max_ms, late_ms);
+    LOG_WRN("Indicator step ran %u ms late", late_ms);
+}
+
+
+void indicator_health_stats_get(struct indicator_health_stats *out)
+{
+    *out = stats;
+}
+
+
+static void recover_handler(struct k_work *work)
+{
+    atomic_val_t attempt = atomic_get(&in_a_row);
+
+    ARG_UNUSED(work);
+
+    if (attempt > CONFIG_INDICATOR_HEALTH_MAX_RECOVERIES)
+    {
+        LOG_ERR("Indicator did not recover after %ld attempts, rebooting", attempt - 1);
+        LOG_PANIC();
+        sys_reboot(SYS_REBOOT_WARM);
+    }
+    LOG_WRN("Indicator worker stalled, recovering (attempt %ld)", attempt);
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+    if (hx_bus_reset(K_MSEC(CONFIG_INDICATOR_HEALTH_TIMEOUT_MS / 2)) != 0)
+    {
+        LOG_WRN("HX bus still held after the clear");
+    }
+#endif
+    indicator_refresh();                            // current step again, then the pattern resumes
+    (void)task_wdt_feed(channel);                   // re-arm, the worker's next feed completes recovery
+}
+
+
+/* Task watchdog timer context */
+static void expired(int id, void *user_data)
+{
+    ARG_UNUSED(id);
+    ARG_UNUSED(user_data);
+
+    if (atomic_cas(&recovering, 0, 1))
+    {
+        stalled_at = k_cycle_get_32();
+    }
+    stats.stalls++;
+    atomic_inc(&in_a_row);
+    k_work_submit(&recover_work);
+}
+
+
+void indicator_health_suspend(void)
+{
+    if (channel < 0 || atomic_get(&recovering) != 0)
+    {
+        return;                                     // a recovery ends with a feed, not a suspend
+    }
+    (void)task_wdt_delete(channel);
+    channel = -1;
+    suspended = true;
+}
+
+
+void indicator_health_resume(void)
+{
+    int ret;
+
+    if (!suspended)
+    {
+        return;
+    }
+    suspended = false;
+    ret = task_wdt_add(CONFIG_INDICATOR_HEALTH_TIMEOUT_MS, expired, NULL);
+    if (ret < 0)
+    {
+        LOG_ERR("Task watchdog channel not restored (%d)", ret);
+        return;
+    }
+    channel = ret;
+}
+
+
+static int indicator_health_init(void)
+{
+    const struct device *hw_wdt = NULL;
+    int ret;
+
+#if defined(CONFIG_INDICATOR_HEALTH_HW_WDT)
+    hw_wdt = DEVICE_DT_GET(DT_ALIAS(watchdog0));
+    if (!device_is_ready(hw_wdt))
+    {
+        LOG_WRN("Hardware watchdog not ready, task watchdog only");
+        hw_wdt = NULL;
+    }
+#endif
+    k_work_init(&recover_work, recover_handler);
+    ret = task_wdt_init(hw_wdt);
+    if (ret < 0)
+    {
+        LOG_ERR("Task watchdog setup failed (%d)", ret);
+        return ret;
+    }
+    suspended = true;                               // the worker's next heartbeat adds the channel
+    return 0;
+}
+
+SYS_INIT(indicator_health_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
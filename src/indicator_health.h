@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_HEALTH_H_
+#define INDICATOR_HEALTH_H_
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+struct indicator_health_stats {
+    uint32_t stalls;            /* watchdog expiries */
+    uint32_t recovered;
+    uint32_t missed_ticks;      /* steps that ran more than CONFIG_INDICATOR_HEALTH_LATE_MS late */
+    uint32_t late_max_ms;
+    uint32_t recovery_last_us;  /* stall detected to the worker running again */
+    uint32_t recovery_max_us;
+};
+
+#if defined(CONFIG_INDICATOR_HEALTH)
+
+/** The indicator worker is alive. Indicator worker only. */
+void indicator_health_feed(void);
+
+/** A step ran late_ms after it was due. Indicator worker only. */
+void indicator_health_tick(uint32_t late_ms);
+
+/** The worker went idle: stop watching it. Indicator worker only. */
+void indicator_health_suspend(void);
+
+/** The worker has work again: watch it from the next feed. Indicator worker only. */
+void indicator_health_resume(void);
+
+void indicator_health_stats_get(struct indicator_health_stats *stats);
+
+#else
+
+static inline void indicator_health_feed(void) { }
+static inline void indicator_health_tick(uint32_t late_ms) { ARG_UNUSED(late_ms); }
+static inline void indicator_health_suspend(void) { }
+static inline void indicator_health_resume(void) { }
+
+#endif /* CONFIG_INDICATOR_HEALTH */
+
+#endif /* INDICATOR_HEALTH_H_ */
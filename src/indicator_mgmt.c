@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Indicator counters as the "rgbi" stats group, readable over SMP with the
+ * MCUmgr stat group (mcumgr stat read rgbi). Every counter has one writer:
+ * the indicator worker, or for "coalesced" the request path that already
+ * holds the indicator lock. Updates are plain 32-bit increments with no lock
+ * of their own, and a reader on another thread sees whole values. Sub-unit
+ * remainders (set_color time below 1 ms, charge below 1 mJ) are carried privately,
+ * so the exported counters only ever count up.
+ *
+ * The energy estimate integrates the level on each channel over the time it
+ * was shown, at CONFIG_INDICATOR_MGMT_STATS_CHANNEL_UA per channel and
+ * CONFIG_INDICATOR_MGMT_STATS_LED_MV. Engine blinks and dot-current dimming are
+ * not modelled, so it is an upper bound when brightness runs through dot current.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/stats/stats.h>
+
+#include "indicator_mgmt.h"
+
+#define PJ_PER_MJ 1000000000ULL
+
+STATS_SECT_START(rgbi_stats)
+STATS_SECT_ENTRY32(writes)
+STATS_SECT_ENTRY32(errors)
+STATS_SECT_ENTRY32(coalesced)
+STATS_SECT_ENTRY32(throttled)
+STATS_SECT_ENTRY32(set_color_ms)
+STATS_SECT_ENTRY32(lat_max_us)
+STATS_SECT_ENTRY32(deadline_miss)
+STATS_SECT_ENTRY32(led_mj)
+STATS_SECT_END;
+
+STATS_NAME_START(rgbi_stats)
+STATS_NAME(rgbi_stats, writes)
+STATS_NAME(rgbi_stats, errors)
+STATS_NAME(rgbi_stats, coalesced)
+STATS_NAME(rgbi_stats, throttled)
+STATS_NAME(rgbi_stats, set_color_ms)
+STATS_NAME(rgbi_stats, lat_max_us)
+STATS_NAME(rgbi_stats, deadline_miss)
+STATS_NAME(rgbi_stats, led_mj)
+STATS_NAME_END(rgbi_stats);
+
+static STATS_SECT_DECL(rgbi_stats) rgbi_stats;
+
+/* worker side remainders */
+static uint32_t set_color_rem_us;
+static uint64_t charge_pj;
+static uint32_t level_ua;                   // current drawn by the color on the LED
+static uint32_t level_since_ms;
+
+
+void indicator_mgmt_frame(const struct led_rgb *out, uint32_t cycles, int ret)
+{
+    uint32_t now = k_uptime_get_32();
+
+    set_color_rem_us += k_cyc_to_us_floor32(cycles);
+    if (set_color_rem_us >= USEC_PER_MSEC)
+    {
+        STATS_INCN(rgbi_stats, set_color_ms, set_color_rem_us / USEC_PER_MSEC);
+        set_color_rem_us %= USEC_PER_MSEC;
+    }
+    if (ret != 0)
+    {
+        STATS_INC(rgbi_stats, errors);
+        return;                             // LED still shows the old level
+    }
+    STATS_INC(rgbi_stats, writes);
+
+    /* uA * mV * ms = pJ */
+    charge_pj += (uint64_t)level_ua * CONFIG_INDICATOR_MGMT_STATS_LED_MV * (now - level_since_ms);
+    if (charge_pj >= PJ_PER_MJ)
+    {
+        uint32_t mj = (uint32_t)(charge_pj / PJ_PER_MJ);
+
+        STATS_INCN(rgbi_stats, led_mj, mj);
+        charge_pj -= mj * PJ_PER_MJ;
+    }
+    level_ua = ((uint32_t)out->r + out->g + out->b) * CONFIG_INDICATOR_MGMT_STATS_CHANNEL_UA / UINT8_MAX;
+    level_since_ms = now;
+}
+
+
+void indicator_mgmt_throttled(void)
+{
+    STATS_INC(rgbi_stats, throttled);
+}
+
+
+void indicator_mgmt_latency(uint32_t us)
+{
+    if (us > rgbi_stats.lat_max_us)
+    {
+        STATS_SET(rgbi_stats, lat_max_us, us);
+    }
+}
+
+
+void indicator_mgmt_deadline_missed(void)
+{
+    STATS_INC(rgbi_stats, deadline_miss);
+}
+
+
+void indicator_mgmt_coalesced(void)
+{
+    STATS_INC(rgbi_stats, coalesced);
+}
+
+
+static int indicator_mgmt_init(void)
+{
+    /* zeroes the group, so this runs before any indicator init level */
+    return STATS_INIT_AND_REG(rgbi_stats, STATS_SIZE_32, "rgbi");
+}
+
+SYS_INIT(indicator_mgmt_init, POST_KERNEL, 0);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_MGMT_H_
+#define INDICATOR_MGMT_H_
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <rgb_indicator.h>
+
+#if defined(CONFIG_INDICATOR_MGMT_STATS)
+
+/**
+ * A color frame went to the backend (ret is its result). cycles is the whole
+ * set_color call, bus lock wait included, not just the wire time. out is the
+ * level written, after gamma and brightness. Indicator worker only.
+ */
+void indicator_mgmt_frame(const struct led_rgb *out, uint32_t cycles, int ret);
+
+/** A step was stretched to keep inside the bus budget. Indicator worker only. */
+void indicator_mgmt_throttled(void);
+
+/** Request to first write latency. Indicator worker only. */
+void indicator_mgmt_latency(uint32_t us);
+
+/** A deadline request reached the LED late. Indicator worker only. */
+void indicator_mgmt_deadline_missed(void);
+
+/** A pending request was replaced before the worker showed it. Under the indicator request lock. */
+void indicator_mgmt_coalesced(void);
+
+#else
+
+static inline void indicator_mgmt_frame(const struct led_rgb *out, uint32_t cycles, int ret)
+{
+    ARG_UNUSED(out);
+    ARG_UNUSED(cycles);
+    ARG_UNUSED(ret);
+}
+static inline void indicator_mgmt_throttled(void) { }
+static inline void indicator_mgmt_latency(uint32_t us) { ARG_UNUSED(us); }
+static inline void indicator_mgmt_deadline_missed(void) { }
+static inline void indicator_mgmt_coalesced(void) { }
+
+#endif /* CONFIG_INDICATOR_MGMT_STATS */
+
+#endif /* INDICATOR_MGMT_H_ */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Indicator user profile on Zephyr settings. Changes take effect in RAM at
+ * once; the flash write is debounced (each change pushes it back by
+ * CONFIG_INDICATOR_PROFILE_SAVE_DELAY_MS, but never past
+ * CONFIG_INDICATOR_PROFILE_SAVE_MAX_DELAY_MS from the first unsaved change) and
+ * coalesced (only keys that differ from what is in flash are written). A user
+ * dragging a brightness slider therefore costs one write, done on the system
+ * work queue, away from the indicator worker.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/settings/settings.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(indicator_profile, LOG_LEVEL_INF);
+
+#include "indicator_profile.h"
+#include "indicator.h"
+
+#define KEY_BRIGHT  BIT(0)
+#define KEY_NIGHT   BIT(1)
+#define KEY_PATTERN BIT(2)
+
+struct night {
+    uint16_t start_min;
+    uint16_t end_min;
+    uint8_t pct;
+} __packed;
+
+static struct indicator_profile profile = {
+    .brightness = 100,
+    .night_brightness = 20,
+};
+static struct indicator_profile persisted;          // what flash holds
+static uint8_t dirty;
+static int64_t first_dirty_ms;
+static indicator_profile_cb_t profile_cb;
+static struct indicator_profile_stats stats;
+static struct k_work_delayable save_work;
+static K_MUTEX_DEFINE(lock);
+
+
+static void notify(void)
+{
+    struct indicator_profile p = profile;           // callback runs unlocked
+
+    k_mutex_unlock(&lock);
+    if (profile_cb != NULL)
+    {
+        profile_cb(&p);
+    }
+}
+
+
+/* Called with the lock held; releases it */
+static void changed(uint8_t keys)
+{
+    int64_t now = k_uptime_get();
+    int64_t delay = CONFIG_INDICATOR_PROFILE_SAVE_DELAY_MS;
+
+    stats.changes++;
+    if (dirty == 0)
+    {
+        first_dirty_ms = now;
+    }
+    dirty |= keys;
+    delay = MIN(delay, MAX(0, first_dirty_ms + CONFIG_INDICATOR_PROFILE_SAVE_MAX_DELAY_MS - now));
+    k_work_reschedule(&save_work, K_MSEC(delay));
+    notify();
+}
+
+
+static void save_handler(struct k_work *work)
+{
+    struct indicator_profile p;
+    struct night n;
+    uint8_t keys;
+    uint8_t failed = 0;
+
+    ARG_UNUSED(work);
+    k_mutex_lock(&lock, K_FOREVER);
+    p = profile;
+    keys = dirty;
+    dirty = 0;
+    k_mutex_unlock(&lock);
+
+    if ((keys & KEY_BRIGHT) && p.brightness != persisted.brightness)
+    {
+        if (settings_save_one("rgbi/bright", &p.brightness, sizeof(p.brightness)) == 0)
+        {
+            persisted.brightness = p.brightness;
+            stats.flash_writes++;
+        }
+        else
+        {
+            failed |= KEY_BRIGHT;
+        }
+    }
+    if ((keys & KEY_NIGHT) && (p.night_start_min != persisted.night_start_min ||
+                               p.night_end_min != persisted.night_end_min ||
+                               p.night_brightness != persisted.night_brightness))
+    {
+        n.start_min = p.night_start_min;
+        n.end_min = p.night_end_min;
+        n.pct = p.night_brightness;
+        if (settings_save_one("rgbi/night", &n, sizeof(n)) == 0)
+        {
+            persisted.night_start_min = n.start_min;
+            persisted.night_end_min = n.end_min;
+            persisted.night_brightness = n.pct;
+            stats.flash_writes++;
+        }
+        else
+        {
+            failed |= KEY_NIGHT;
+        }
+    }
+    if ((keys & KEY_PATTERN) && strcmp(p.pattern, persisted.pattern) != 0)
+    {
+        if (settings_save_one("rgbi/pattern", p.pattern, strlen(p.pattern) + 1) == 0)
+        {
+            memcpy(persisted.pattern, p.pattern, sizeof(p.pattern));
+            stats.flash_writes++;
+        }
+        else
+        {
+            failed |= KEY_PATTERN;
+        }
+    }
+
+    if (failed != 0)
+    {
+        LOG_WRN("Profile keys 0x%x not saved, retrying", failed);
+        k_mutex_lock(&lock, K_FOREVER);
+        if (dirty == 0)
+        {
+            first_dirty_ms = k_uptime_get();
+        }
+        dirty |= failed;                            // back in with anything changed meanwhile
+        k_mutex_unlock(&lock);
+        k_work_schedule(&save_work, K_MSEC(CONFIG_INDICATOR_PROFILE_SAVE_DELAY_MS));    // keeps an earlier save
+    }
+}
+
+
+void indicator_profile_get(struct indicator_profile *out)
+{
+    k_mutex_lock(&lock, K_FOREVER);
+    *out = profile;
+    k_mutex_unlock(&lock);
+}
+
+
+void indicator_profile_set_brightness(uint8_t pct)
+{
+    pct = MIN(pct, 100);
+    k_mutex_lock(&lock, K_FOREVER);
+    if (pct == profile.brightness)
+    {
+        k_mutex_unlock(&lock);
+        return;
+    }
+    profile.brightness = pct;
+    changed(KEY_BRIGHT);
+}
+
+
+void indicator_profile_set_night(uint16_t start_min, uint16_t end_min, uint8_t pct)
+{
+    start_min %= 24 * 60;
+    end_min %= 24 * 60;
+    pct = MIN(pct, 100);
+    k_mutex_lock(&lock, K_FOREVER);
+    if (start_min == profile.night_start_min && end_min == profile.night_end_min &&
+        pct == profile.night_brightness)
+    {
+        k_mutex_unlock(&lock);
+        return;
+    }
+    profile.night_start_min = start_min;
+    profile.night_end_min = end_min;
+    profile.night_brightness = pct;
+    changed(KEY_NIGHT);
+}
+
+
+int indicator_profile_set_pattern(const char *name)
+{
+    const struct indicator_pattern *pattern = NULL;
+
+    if (name[0] != '\0' && (pattern = indicator_pattern_find(name)) == NULL)
+    {
+        return -ENOENT;
+    }
+    if (strlen(name) >= INDICATOR_PROFILE_PATTERN_LEN)
+    {
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&lock, K_FOREVER);
+    if (strcmp(name, profile.pattern) == 0)
+    {
+        k_mutex_unlock(&lock);
+        return 0;
+    }
+    strcpy(profile.pattern, name);
+    changed(KEY_PATTERN);
+
+    if (pattern != NULL)
+    {
+        indicator_play(pattern);
+    }
+    else
+    {
+        indicator_stop();
+    }
+    return 0;
+}
+
+
+void indicator_profile_set_callback(indicator_profile_cb_t cb)
+{
+    profile_cb = cb;
+}
+
+
+void indicator_profile_flush(void)
+{
+    struct k_work_sync sync;
+
+    if (k_work_cancel_delayable_sync(&save_work, &sync) || dirty != 0)
+    {
+        save_handler(&save_work.work);
+    }
+}
+
+
+void indicator_profile_stats_get(struct indicator_profile_stats *out)
+{
+    int64_t up_s = MAX(k_uptime_get() / MSEC_PER_SEC, 1);
+
+    *out = stats;
+    out->coalesced = stats.changes > stats.flash_writes ? stats.changes - stats.flash_writes : 0;
+    out->writes_per_hour = (uint32_t)((int64_t)stats.flash_writes * 3600 / up_s);
+}
+
+
+static int profile_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+    struct night n;
+
+    if (strcmp(key, "bright") == 0 && len == sizeof(profile.brightness))
+    {
+        return MIN(read_cb(cb_arg, &profile.brightness, len), 0);
+    }
+    if (strcmp(key, "night") == 0 && len == sizeof(n))
+    {
+        if (read_cb(cb_arg, &n, len) < 0)
+        {
+            return -EIO;
+        }
+        profile.night_start_min = n.start_min;
+        profile.night_end_min = n.end_min;
+        profile.night_brightness = n.pct;
+        return 0;
+    }
+    if (strcmp(key, "pattern") == 0 && len <= sizeof(profile.pattern))
+    {
+        if (read_cb(cb_arg, profile.pattern, len) < 0)
+        {
+            return -EIO;
+        }
+        profile.pattern[sizeof(profile.pattern) - 1] = '\0';
+        return 0;
+    }
+    return -ENOENT;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(rgbi, "rgbi", NULL, profile_set, NULL, NULL);
+
+
+static int indicator_profile_init(void)
+{
+    const struct indicator_pattern *pattern;
+    int ret;
+
+    k_work_init_delayable(&save_work, save_handler);
+
+    ret = settings_subsys_init();
+    if (ret == 0)
+    {
+        ret = settings_load_subtree("rgbi");
+    }
+    if (ret != 0)
+    {
+        LOG_WRN("Profile not loaded (%d), using defaults", ret);
+    }
+
+    k_mutex_lock(&lock, K_FOREVER);
+    persisted = profile;
+    LOG_INF("Profile: brightness %u%%, night %u-%u min at %u%%, pattern \"%s\"", profile.brightness,
+            profile.night_start_min, profile.night_end_min, profile.night_brightness, profile.pattern);
+    pattern = profile.pattern[0] != '\0' ? indicator_pattern_find(profile.pattern) : NULL;
+    notify();
+
+    if (pattern != NULL && !indicator_restored())
+    {
+        indicator_play(pattern);
+    }
+    return 0;
+}
+
+SYS_INIT(indicator_profile_init, APPLICATION, CONFIG_INDICATOR_CLIENT_INIT_PRIORITY);
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_PROFILE_H_
+#define INDICATOR_PROFILE_H_
+
+#include <stdint.h>
+
+#define INDICATOR_PROFILE_PATTERN_LEN 24
+
+/* User settings for the indicator, persisted under "rgbi/" */
+struct indicator_profile {
+    uint8_t brightness;                 /* % */
+    uint8_t night_brightness;           /* %, inside the night window */
+    uint16_t night_start_min;           /* minutes after midnight, start == end: no night mode */
+    uint16_t night_end_min;
+    char pattern[INDICATOR_PROFILE_PATTERN_LEN];   /* idle pattern name, "" = none */
+};
+
+struct indicator_profile_stats {
+    uint32_t changes;                   /* setter calls that changed a value */
+    uint32_t flash_writes;              /* settings_save_one() calls */
+    uint32_t coalesced;                 /* changes that never reached flash on their own */
+    uint32_t writes_per_hour;           /* flash writes over uptime, scaled to an hour */
+};
+
+typedef void (*indicator_profile_cb_t)(const struct indicator_profile *profile);
+
+/** Current profile (defaults until settings are loaded). */
+void indicator_profile_get(struct indicator_profile *profile);
+
+/*
+ * Setters apply at once (the callback runs in the caller's context) and only
+ * schedule the flash write, so calling them at slider rate is fine.
+ */
+void indicator_profile_set_brightness(uint8_t pct);
+void indicator_profile_set_night(uint16_t start_min, uint16_t end_min, uint8_t pct);
+int indicator_profile_set_pattern(const char *name);
+
+/** Called with the new profile after a load or any change. One listener. */
+void indicator_profile_set_callback(indicator_profile_cb_t cb);
+
+/** Write pending changes now (e.g. before a planned reset). */
+void indicator_profile_flush(void);
+
+void indicator_profile_stats_get(struct indicator_profile_stats *stats);
+
+#endif /* INDICATOR_PROFILE_H_ */
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * System status to indicator. A Zbus listener on the connectivity, battery and
+ * fault channels folds each message into a small status snapshot and picks the
+ * pattern from const tables: the first matching rule wins, connectivity is the
+ * fallback. Listeners run in the publisher's context and indicator_play_from()
+ * only swaps a pointer, so no thread is added; the pattern is only restarted
+ * when the choice actually changes.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(indicator_status, LOG_LEVEL_INF);
+
+#include "indicator_status.h"
+#include "status_chan.h"
+
+INDICATOR_PATTERN(indicator_pattern_fault, 0,
+    { RGB(100, 0, 0), 100 },
+    { RGB(0, 0, 0), 100 });
+
+INDICATOR_PATTERN(indicator_pattern_battery_low, 0,
+    { RGB(100, 40, 0), 200 },
+    { RGB(0, 0, 0), 1800, 200 });
+
+INDICATOR_PATTERN(indicator_pattern_offline, 1,
+    { RGB(10, 10, 10), 0 });
+
+INDICATOR_PATTERN(indicator_pattern_searching, 0,
+    { RGB(0, 0, 100), 500 },
+    { RGB(0, 0, 0), 500 });
+
+INDICATOR_PATTERN(indicator_pattern_connected, 1,
+    { RGB(0, 60, 0), 0 });
+
+INDICATOR_PATTERN(indicator_pattern_conn_error, 0,
+    { RGB(100, 0, 0), 150 },
+    { RGB(0, 0, 0), 150 },
+    { RGB(100, 0, 0), 150 },
+    { RGB(0, 0, 0), 1050, 100 });
+
+struct status_state {
+    uint8_t conn;
+    uint8_t battery_pct;
+    bool charging;
+    bool fault;
+};
+
+struct status_rule {
+    bool (*match)(const struct status_state *s);
+    const struct indicator_pattern *pattern;
+};
+
+
+static bool fault_active(const struct status_state *s)
+{
+    return s->fault;
+}
+
+
+static bool battery_low(const struct status_state *s)
+{
+    return !s->charging && s->battery_pct <= CONFIG_INDICATOR_STATUS_BATTERY_LOW_PCT;
+}
+
+
+static const struct status_rule rules[] = {
+    { fault_active, &indicator_pattern_fault },
+    { battery_low, &indicator_pattern_battery_low },
+};
+
+static const struct indicator_pattern *const conn_patterns[STATUS_CONN_COUNT] = {
+    [STATUS_CONN_OFFLINE] = &indicator_pattern_offline,
+    [STATUS_CONN_SEARCHING] = &indicator_pattern_searching,
+    [STATUS_CONN_CONNECTED] = &indicator_pattern_connected,
+    [STATUS_CONN_ERROR] = &indicator_pattern_conn_error,
+};
+
+static struct status_state state = {
+    .conn = STATUS_CONN_OFFLINE,
+    .battery_pct = 100,
+};
+static const struct indicator_pattern *showing;
+static struct indicator_status_stats stats;
+static struct k_spinlock lock;
+
+
+static const struct indicator_pattern *pick(const struct status_state *s)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(rules); i++)
+    {
+        if (rules[i].match(s))
+        {
+            return rules[i].pattern;
+        }
+    }
+    return conn_patterns[s->conn < STATUS_CONN_COUNT ? s->conn : STATUS_CONN_ERROR];
+}
+
+
+static void status_listener(const struct zbus_channel *chan)
+{
+    const struct indicator_pattern *pattern;
+    bool changed;
+    uint32_t origin;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (chan == &status_conn_chan)
+    {
+        const struct status_conn_msg *msg = zbus_chan_const_msg(chan);
+
+        state.conn = msg->state;
+        origin = msg->cycles;
+    }
+    else if (chan == &status_battery_chan)
+    {
+        const struct status_battery_msg *msg = zbus_chan_const_msg(chan);
+
+        state.battery_pct = msg->percent;
+        state.charging = msg->charging;
+        origin = msg->cycles;
+    }
+    else
+    {
+        const struct status_fault_msg *msg = zbus_chan_const_msg(chan);
+
+        state.fault = msg->active;
+        origin = msg->cycles;
+    }
+
+    pattern = pick(&state);
+    changed = pattern != showing;
+    showing = pattern;
+    stats.msgs++;
+    stats.changes += changed ? 1 : 0;
+    k_spin_unlock(&lock, key);
+
+    if (changed)
+    {
+        indicator_play_from(pattern, origin != 0 ? origin : k_cycle_get_32());
+    }
+}
+
+ZBUS_LISTENER_DEFINE(indicator_status_lis, status_listener);
+
+ZBUS_CHAN_ADD_OBS(status_conn_chan, indicator_status_lis, 0);
+ZBUS_CHAN_ADD_OBS(status_battery_chan, indicator_status_lis, 0);
+ZBUS_CHAN_ADD_OBS(status_fault_chan, indicator_status_lis, 0);
+
+
+void indicator_status_stats_get(struct indicator_status_stats *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    *out = stats;
+    k_spin_unlock(&lock, key);
+}
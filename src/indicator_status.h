@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_STATUS_H_
+#define INDICATOR_STATUS_H_
+
+#include <stdint.h>
+#include "indicator.h"
+
+struct indicator_status_stats {
+    uint32_t msgs;              /* status messages seen */
+    uint32_t changes;           /* messages that changed the pattern */
+};
+
+/* Status patterns, highest priority first */
+extern const struct indicator_pattern indicator_pattern_fault;
+extern const struct indicator_pattern indicator_pattern_battery_low;
+extern const struct indicator_pattern indicator_pattern_offline;
+extern const struct indicator_pattern indicator_pattern_searching;
+extern const struct indicator_pattern indicator_pattern_connected;
+extern const struct indicator_pattern indicator_pattern_conn_error;
+
+/**
+ * Message-to-LED latency is in indicator_stats_get(): each pattern change is
+ * started with the publisher's timestamp as its origin.
+ */
+void indicator_status_stats_get(struct indicator_status_stats *stats);
+
+#endif /* INDICATOR_STATUS_H_ */
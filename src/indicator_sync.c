@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lockstep indicators across boards in one enclosure. The leader drives a
+ * short pulse on hxctrl every CONFIG_INDICATOR_SYNC_PERIOD_MS; followers have
+ * it wired to hxrqst and timestamp the rising edge in the GPIO interrupt.
+ * Every board keeps a pattern clock disciplined to the pulse: the edge time
+ * sets the phase, and the error against the predicted edge trims the local
+ * estimate of the pulse period (a first order frequency loop), so the clock
+ * keeps time through a missed pulse. The indicator starts each pattern pass
+ * on the nearest boundary of this clock.
+ *
+ * CONFIG_INDICATOR_SYNC_LOOPBACK mirrors the leader's hxctrl onto its own
+ * hxrqst on the emulated GPIO controller, so the capture path and the loop
+ * run on native_sim (boards/sync_loopback.overlay).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/gpio.h>
+#if defined(CONFIG_INDICATOR_SYNC_LOOPBACK)
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(indicator_sync, LOG_LEVEL_INF);
+
+#include "indicator_sync.h"
+
+#define FREQ_GAIN       8               // 1/8 of each period error goes into the period estimate
+#define LOCK_EDGES      3               // consecutive edges inside the window to call it locked
+#define REPORT_EDGES    16
+
+
+static struct k_spinlock lock;
+static uint32_t nominal_cyc;
+static uint64_t period_q8;              // local cycles per pulse period, Q24.8
+static uint32_t last_edge;
+static uint8_t in_window;
+static struct indicator_sync_stats stats;
+static struct k_work report_work;
+
+#if defined(CONFIG_INDICATOR_SYNC_FOLLOWER) || defined(CONFIG_INDICATOR_SYNC_LOOPBACK)
+static const struct gpio_dt_spec hxrqst = GPIO_DT_SPEC_GET(DT_NODELABEL(hxrqst), gpios);
+static struct gpio_callback capture_cb;
+#endif
+#if defined(CONFIG_INDICATOR_SYNC_LEADER)
+static const struct gpio_dt_spec hxctrl = GPIO_DT_SPEC_GET(DT_NODELABEL(hxctrl), gpios);
+static struct k_timer pulse_timer;
+#endif
+
+
+/* A pulse edge at local cycle stamp t. ISR context. */
+static void clock_edge(uint32_t t)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    uint32_t period = (uint32_t)(period_q8 >> 8);
+    uint32_t since = t - last_edge;
+    uint32_t n = (since + period / 2) / period;         // periods since the last edge, > 1 if pulses went missing
+    int32_t err;
+    bool report = false;
+
+    if (stats.edges == 0)
+    {
+        stats.edges++;
+        last_edge = t;                                  // first edge: phase only
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    if (n == 0)
+    {
+        stats.glitches++;                               // bounce inside a period, the grid stays on the real edge
+        k_spin_unlock(&lock, key);
+        return;
+    }
+    stats.edges++;
+
+    err = (int32_t)(since - n * period);
+    period_q8 += ((int64_t)err << 8) / ((int64_t)n * FREQ_GAIN);
+    last_edge = t;
+    stats.missed += n - 1;
+    stats.err_us = err < 0 ? -(int32_t)k_cyc_to_us_near32(-err) : (int32_t)k_cyc_to_us_near32(err);
+    stats.period_ppm = (int32_t)(((int64_t)period_q8 - ((int64_t)nominal_cyc << 8)) * 1000000 /
+                                 ((int64_t)nominal_cyc << 8));
+
+    if ((uint32_t)ABS(stats.err_us) <= CONFIG_INDICATOR_SYNC_LOCK_US)
+    {
+        if (!stats.locked && ++in_window >= LOCK_EDGES)
+        {
+            stats.locked = true;
+            report = true;
+        }
+        if (stats.locked)
+        {
+            stats.err_max_us = MAX(stats.err_max_us, (uint32_t)ABS(stats.err_us));
+        }
+    }
+    else
+    {
+        in_window = 0;
+        report = stats.locked;
+        stats.locked = false;
+    }
+    report |= stats.edges % REPORT_EDGES == 0;
+    k_spin_unlock(&lock, key);
+
+    if (report)
+    {
+        k_work_submit(&report_work);
+    }
+}
+
+
+static void report_handler(struct k_work *work)
+{
+    struct indicator_sync_stats s;
+
+    ARG_UNUSED(work);
+    indicator_sync_stats_get(&s);
+    LOG_INF("Sync %s: %u edges (%u missed, %u glitches), phase error %d us (max %u), period %d ppm, "
+            "%u passes aligned", s.locked ? "locked" : "unlocked", s.edges, s.missed, s.glitches, s.err_us,
+            s.err_max_us, s.period_ppm, s.aligned);
+}
+
+
+uint32_t indicator_sync_align_us(uint32_t nominal_us, uint32_t pass_us)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool locked = stats.locked;
+    uint32_t edge = last_edge;
+    uint64_t period = period_q8;
+    uint32_t nominal = k_us_to_cyc_near32(nominal_us);
+    uint32_t pass;
+    uint32_t off;
+
+    if (locked && pass_us != 0)
+    {
+        stats.aligned++;
+    }
+    k_spin_unlock(&lock, key);
+    if (!locked || pass_us == 0)
+    {
+        return nominal_us;
+    }
+
+    /* pass length in the leader's time, then where the nominal start falls on the grid */
+    pass = (uint32_t)(k_us_to_cyc_near64(pass_us) * period / ((uint64_t)nominal_cyc << 8));
+    if (pass == 0)
+    {
+        return nominal_us;
+    }
+    off = (k_cycle_get_32() + nominal - edge) % pass;
+    if (off <= pass / 2 && off <= nominal)
+    {
+        return k_cyc_to_us_near32(nominal - off);      // early to the boundary behind
+    }
+    return k_cyc_to_us_near32(nominal + (pass - off));  // or wait for the one ahead
+}
+
+
+void indicator_sync_stats_get(struct indicator_sync_stats *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    *out = stats;
+    k_spin_unlock(&lock, key);
+}
+
+
+#if defined(CONFIG_INDICATOR_SYNC_FOLLOWER) || defined(CONFIG_INDICATOR_SYNC_LOOPBACK)
+static void capture_handler(const struct device *port, struct gpio_callback *cb, uint32_t pins)
+{
+    uint32_t t = k_cycle_get_32();
+
+    ARG_UNUSED(port);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+    clock_edge(t);
+}
+#endif
+
+
+#if defined(CONFIG_INDICATOR_SYNC_LEADER)
+static void drive(int value)
+{
+    (void)gpio_pin_set_dt(&hxctrl, value);
+#if defined(CONFIG_INDICATOR_SYNC_LOOPBACK)
+    (void)gpio_emul_input_set(hxrqst.port, hxrqst.pin, value);      // the wire to a follower
+#endif
+}
+
+
+static void pulse_handler(struct k_timer *timer)
+{
+    uint32_t t = k_cycle_get_32();
+
+    ARG_UNUSED(timer);
+    drive(1);
+    if (!IS_ENABLED(CONFIG_INDICATOR_SYNC_LOOPBACK))
+    {
+        clock_edge(t);                                  // the leader's clock follows its own pulse
+    }
+    k_busy_wait(CONFIG_INDICATOR_SYNC_PULSE_US);
+    drive(0);
+}
+#endif
+
+
+static int indicator_sync_init(void)
+{
+    int ret = 0;
+
+    nominal_cyc = k_ms_to_cyc_near32(CONFIG_INDICATOR_SYNC_PERIOD_MS);
+    period_q8 = (uint64_t)nominal_cyc << 8;
+    k_work_init(&report_work, report_handler);
+
+#if defined(CONFIG_INDICATOR_SYNC_FOLLOWER) || defined(CONFIG_INDICATOR_SYNC_LOOPBACK)
+    if (!gpio_is_ready_dt(&hxrqst))
+    {
+        LOG_ERR("hxrqst not ready");
+        return -ENODEV;
+    }
+    ret = gpio_pin_configure_dt(&hxrqst, GPIO_INPUT);
+    if (ret == 0)
+    {
+        ret = gpio_pin_interrupt_configure_dt(&hxrqst, GPIO_INT_EDGE_TO_ACTIVE);
+    }
+    if (ret == 0)
+    {
+        gpio_init_callback(&capture_cb, capture_handler, BIT(hxrqst.pin));
+        ret = gpio_add_callback_dt(&hxrqst, &capture_cb);
+    }
+#endif
+#if defined(CONFIG_INDICATOR_SYNC_LEADER)
+    if (ret == 0)
+    {
+        ret = gpio_is_ready_dt(&hxctrl) ? gpio_pin_configure_dt(&hxctrl, GPIO_OUTPUT_INACTIVE) : -ENODEV;
+    }
+    if (ret == 0)
+    {
+        k_timer_init(&pulse_timer, pulse_handler, NULL);
+        k_timer_start(&pulse_timer, K_MSEC(CONFIG_INDICATOR_SYNC_PERIOD_MS), K_MSEC(CONFIG_INDICATOR_SYNC_PERIOD_MS));
+    }
+#endif
+    if (ret != 0)
+    {
+        LOG_ERR("Sync pin setup failed (%d)", ret);
+        return ret;
+    }
+    LOG_INF("Sync %s%s, pulse every %d ms", IS_ENABLED(CONFIG_INDICATOR_SYNC_LEADER) ? "leader" : "follower",
+            IS_ENABLED(CONFIG_INDICATOR_SYNC_LOOPBACK) ? " (loopback)" : "", CONFIG_INDICATOR_SYNC_PERIOD_MS);
+    return 0;
+}
+
+SYS_INIT(indicator_sync_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
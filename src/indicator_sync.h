@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INDICATOR_SYNC_H_
+#define INDICATOR_SYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+struct indicator_sync_stats {
+    uint32_t edges;
+    uint32_t missed;            /* pulses that never arrived, inferred from the gap */
+    uint32_t glitches;          /* edges under half a period after the last, ignored */
+    int32_t err_us;             /* last edge against the disciplined clock's prediction */
+    uint32_t err_max_us;        /* worst |err_us| while locked */
+    int32_t period_ppm;         /* local clock rate against the leader's */
+    uint32_t aligned;           /* pattern passes started on the grid */
+    bool locked;
+};
+
+#if defined(CONFIG_INDICATOR_SYNC)
+
+/**
+ * Delay for a pattern step due in nominal_us that ends a pass of pass_us: moved
+ * to the nearest boundary of a pass grid anchored on the last sync pulse, so
+ * boards playing the same pattern start each pass together. nominal_us until
+ * the clock has locked.
+ */
+uint32_t indicator_sync_align_us(uint32_t nominal_us, uint32_t pass_us);
+
+void indicator_sync_stats_get(struct indicator_sync_stats *stats);
+
+#else
+
+static inline uint32_t indicator_sync_align_us(uint32_t nominal_us, uint32_t pass_us)
+{
+    ARG_UNUSED(pass_us);
+    return nominal_us;
+}
+
+#endif /* CONFIG_INDICATOR_SYNC */
+
+#endif /* INDICATOR_SYNC_H_ */
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LP5817 autonomous engine, used for blinking so the LED keeps time on its
+ * own and neither the CPU nor the HX bus wakes per edge. One animation unit
+ * per output: PWM1..PWM2 hold the level for the on time, drop at once, PWM3..
+ * PWM4 hold zero for the off time, and the pattern repeats forever.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lp5817_engine, LOG_LEVEL_INF);
+
+#include "lp5817_engine.h"
+#include "lp5817_regs.h"
+#include "lp5817_shadow.h"
+#include "lp5817_status.h"
+
+#define RGBCTRL_NODE DT_NODELABEL(rgbctrl)
+
+static const struct i2c_dt_spec lp5817 = I2C_DT_SPEC_GET(RGBCTRL_NODE);
+static const uint8_t color_map[LP5817_CHANNELS] = DT_PROP(RGBCTRL_NODE, color_mapping);
+
+/* Engine time codes 0..15, in ms */
+static const uint16_t time_ms[] = {
+    0, 90, 180, 360, 540, 800, 1070, 1520, 2060, 2500, 3040, 4020, 5010, 5990, 7060, 8050,
+};
+
+static bool running;                    // only touched with the HX bus held
+
+
+static uint8_t time_code(uint32_t ms)
+{
+    uint8_t best = 0;
+
+    for (uint8_t i = 1; i < ARRAY_SIZE(time_ms); i++)
+    {
+        if (abs((int32_t)time_ms[i] - (int32_t)ms) < abs((int32_t)time_ms[best] - (int32_t)ms))
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+
+int lp5817_engine_blink(void *arg)
+{
+    const struct lp5817_blink *blink = arg;
+    struct led_rgb color = lp5817_status_remap(&blink->color);
+    const uint8_t level[] = { color.r, color.g, color.b };
+    uint8_t on = time_code(MAX(blink->on_ms, 1));           // never round a visible phase to nothing
+    uint8_t off = time_code(MAX(blink->off_ms, 1));
+    uint8_t aeu[LP5817_CHANNELS][LP5817_AUTO_BYTES] = { 0 };
+    int ret = 0;
+
+    for (size_t i = 0; i < LP5817_CHANNELS; i++)
+    {
+        uint8_t *a = aeu[color_map[i]];
+
+        a[LP5817_AUTO_PLAYBACK] = LP5817_AUTO_FOREVER;
+        a[LP5817_AUTO_PWM1 + 0] = level[i];
+        a[LP5817_AUTO_PWM1 + 1] = level[i];
+        a[LP5817_AUTO_PWM1 + 4] = level[i];
+        a[LP5817_AUTO_T12] = on;                            // hold on, then drop in 0 ms
+        a[LP5817_AUTO_T34] = off;                           // hold off, then rise in 0 ms
+    }
+
+    if (running)
+    {
+        ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_STOP_CMD, LP5817_STOP_KEY);
+    }
+    ret |= i2c_burst_write_dt(&lp5817, LP5817_REG_OUT0_AUTO, &aeu[0][0], sizeof(aeu));
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_DEV_CONFIG2, BIT_MASK(LP5817_CHANNELS));
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_UPDATE_CMD, LP5817_UPDATE_KEY);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_START_CMD, LP5817_START_KEY);
+    if (ret != 0)
+    {
+        return -EIO;
+    }
+
+    running = true;
+    lp5817_shadow_set_engine(BIT_MASK(LP5817_CHANNELS), aeu);
+    LOG_DBG("Blink %u/%u ms as %u/%u ms", blink->on_ms, blink->off_ms, time_ms[on], time_ms[off]);
+    return 0;
+}
+
+
+int lp5817_engine_stop(void *arg)
+{
+    int ret = 0;
+
+    ARG_UNUSED(arg);
+    if (!running)
+    {
+        return 0;
+    }
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_STOP_CMD, LP5817_STOP_KEY);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_DEV_CONFIG2, 0);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_UPDATE_CMD, LP5817_UPDATE_KEY);
+    if (ret != 0)
+    {
+        return -EIO;
+    }
+
+    running = false;
+    lp5817_shadow_set_engine(0, NULL);
+    return 0;
+}
+
+
+bool lp5817_engine_running(void)
+{
+    return running;
+}
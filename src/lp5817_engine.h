@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LP5817_ENGINE_H_
+#define LP5817_ENGINE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <rgb_indicator.h>
+
+/* Longest time one engine step can hold, larger requests are clamped */
+#define LP5817_ENGINE_MAX_MS    8050
+
+struct lp5817_blink {
+    struct led_rgb color;
+    uint32_t on_ms;
+    uint32_t off_ms;
+};
+
+#if defined(CONFIG_LP5817_ENGINE)
+
+/**
+ * Hand all three outputs to the LP5817 engine, blinking a struct lp5817_blink
+ * until stopped. An hx_bus_fn_t: call with the HX bus held.
+ */
+int lp5817_engine_blink(void *arg);
+
+/** Return the outputs to manual PWM. An hx_bus_fn_t. */
+int lp5817_engine_stop(void *arg);
+
+/** True while the engine owns the outputs. Call with the HX bus held. */
+bool lp5817_engine_running(void);
+
+#else
+
+static inline bool lp5817_engine_running(void) { return false; }
+static inline int lp5817_engine_stop(void *arg) { ARG_UNUSED(arg); return 0; }
+
+#endif /* CONFIG_LP5817_ENGINE */
+
+#endif /* LP5817_ENGINE_H_ */
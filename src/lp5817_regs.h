@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LP5817 register map, the subset the application touches directly (shadow
+ * restore, status, read-back). Everything else stays with the rgb-indicator
+ * driver.
+ */
+
+#ifndef LP5817_REGS_H_
+#define LP5817_REGS_H_
+
+#include <zephyr/sys/util.h>
+
+#define LP5817_CHANNELS             3
+
+/*
+ * A color update on the wire. The driver writes each output's PWM register
+ * on its own (address + register + value), so a frame is three bytes per
+ * output rather than one auto-increment burst.
+ */
+#define LP5817_COLOR_FRAME_BYTES    (LP5817_CHANNELS * (1 + 1 + 1))
+
+#define LP5817_REG_CHIP_EN          0x00
+#define LP5817_REG_DEV_CONFIG0      0x01    /* bit 0: max current, 0 = 25.5 mA, 1 = 51 mA */
+#define LP5817_REG_DEV_CONFIG1      0x02    /* bits 0..2: OUTx enable */
+#define LP5817_REG_DEV_CONFIG2      0x03    /* bits 0..2: OUTx autonomous (engine) control */
+#define LP5817_REG_UPDATE_CMD       0x0D
+#define LP5817_REG_START_CMD        0x0E
+#define LP5817_REG_STOP_CMD         0x0F
+#define LP5817_REG_FLAG_CLR         0x13
+#define LP5817_REG_OUT0_DC          0x14    /* OUT0..2 dot current, consecutive */
+#define LP5817_REG_OUT0_PWM         0x18    /* OUT0..2 manual PWM, consecutive */
+#define LP5817_REG_OUT0_AUTO        0x1C    /* OUT0..2 engine blocks, LP5817_AUTO_BYTES apart */
+#define LP5817_REG_FLAG             0x40    /* bit 0: POR, bit 1: TSD */
+#define LP5817_REG_LOD_STATUS       0x41    /* bits 0..2: OUTx open */
+#define LP5817_REG_LSD_STATUS       0x42    /* bits 0..2: OUTx shorted */
+
+#define LP5817_CHIP_EN              0x01
+#define LP5817_UPDATE_KEY           0x55    /* latch DEV_CONFIGx */
+#define LP5817_START_KEY            0xFF
+#define LP5817_STOP_KEY             0xAA
+#define LP5817_FLAG_CLR_ALL         0x03
+
+/* Engine block layout, one per output. Times are 4-bit codes, see lp5817_engine.c */
+#define LP5817_AUTO_BYTES           10
+#define LP5817_AUTO_PAUSE           0       /* pause before [7:4], after [3:0] the pattern */
+#define LP5817_AUTO_PLAYBACK        1       /* pattern repeats [3:0], 0xF = forever */
+#define LP5817_AUTO_PWM1            2       /* PWM1..PWM5 levels, consecutive */
+#define LP5817_AUTO_T12             7       /* ramp PWM1->2 [3:0], PWM2->3 [7:4] */
+#define LP5817_AUTO_T34             8       /* ramp PWM3->4 [3:0], PWM4->5 [7:4] */
+#define LP5817_AUTO_AEU_PLAYBACK    9       /* AEU repeats per pass [1:0] */
+#define LP5817_AUTO_FOREVER         0x0F
+
+#define LP5817_FLAG_POR             BIT(0)
+#define LP5817_FLAG_TSD             BIT(1)
+
+#endif /* LP5817_REGS_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LP5817 shadow registers. The configuration half comes from the rgbctrl
+ * devicetree node (the same properties the driver programs at init), the PWM
+ * half is updated from every color the indicator writes. The driver writes
+ * led_rgb components straight into the manual PWM registers, routed through
+ * color-mapping, and the shadow mirrors that.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lp5817_shadow, LOG_LEVEL_INF);
+
+#include "lp5817_shadow.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+
+#define RGBCTRL_NODE DT_NODELABEL(rgbctrl)
+
+/* lp5817_shadow_restore(): five config writes, DC and PWM bursts, engine block and START */
+#define RESTORE_XFERS 9
+
+static const struct i2c_dt_spec lp5817 = I2C_DT_SPEC_GET(RGBCTRL_NODE);
+static const uint8_t color_map[LP5817_CHANNELS] = DT_PROP(RGBCTRL_NODE, color_mapping);
+
+static struct lp5817_shadow shadow = {
+    .chip_en = LP5817_CHIP_EN,
+    .dev_config0 = DT_PROP(RGBCTRL_NODE, max_current),
+    .dev_config1 = BIT_MASK(LP5817_CHANNELS),
+    .dc = DT_PROP(RGBCTRL_NODE, dot_current),
+};
+static struct k_spinlock lock;
+#if defined(CONFIG_HX_BUS_RECOVERY)
+static struct hx_bus_restore restore_hook;
+#endif
+
+
+void lp5817_shadow_set_color(const struct led_rgb *color)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    shadow.pwm[color_map[0]] = color->r;
+    shadow.pwm[color_map[1]] = color->g;
+    shadow.pwm[color_map[2]] = color->b;
+    k_spin_unlock(&lock, key);
+}
+
+
+void lp5817_shadow_set_dc(const uint8_t dc[LP5817_CHANNELS])
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    memcpy(shadow.dc, dc, sizeof(shadow.dc));
+    k_spin_unlock(&lock, key);
+}
+
+
+void lp5817_shadow_set_engine(uint8_t dev_config2, const uint8_t aeu[LP5817_CHANNELS][LP5817_AUTO_BYTES])
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    shadow.dev_config2 = dev_config2;
+    if (aeu != NULL)
+    {
+        memcpy(shadow.aeu, aeu, sizeof(shadow.aeu));
+    }
+    k_spin_unlock(&lock, key);
+}
+
+
+void lp5817_shadow_get(struct lp5817_shadow *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    *out = shadow;
+    k_spin_unlock(&lock, key);
+}
+
+
+int lp5817_shadow_restore(void *arg)
+{
+    struct lp5817_shadow s;
+    uint8_t dc[1 + LP5817_CHANNELS];
+    uint8_t pwm[1 + LP5817_CHANNELS];
+    int ret = 0;
+
+    ARG_UNUSED(arg);
+    lp5817_shadow_get(&s);
+
+    dc[0] = LP5817_REG_OUT0_DC;
+    memcpy(&dc[1], s.dc, LP5817_CHANNELS);
+    pwm[0] = LP5817_REG_OUT0_PWM;
+    memcpy(&pwm[1], s.pwm, LP5817_CHANNELS);
+
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_CHIP_EN, s.chip_en);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_DEV_CONFIG0, s.dev_config0);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_DEV_CONFIG1, s.dev_config1);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_DEV_CONFIG2, s.dev_config2);
+    ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_UPDATE_CMD, LP5817_UPDATE_KEY);
+    ret |= i2c_write_dt(&lp5817, dc, sizeof(dc));                              // auto-increment bursts
+    ret |= i2c_write_dt(&lp5817, pwm, sizeof(pwm));
+
+    if (s.dev_config2 != 0)
+    {
+        ret |= i2c_burst_write_dt(&lp5817, LP5817_REG_OUT0_AUTO, &s.aeu[0][0], sizeof(s.aeu));
+        ret |= i2c_reg_write_byte_dt(&lp5817, LP5817_REG_START_CMD, LP5817_START_KEY);
+    }
+
+    if (ret != 0)
+    {
+        LOG_WRN("Shadow restore incomplete");
+        return -EIO;
+    }
+    LOG_DBG("Restored from shadow, pwm %02x %02x %02x", s.pwm[0], s.pwm[1], s.pwm[2]);
+    return 0;
+}
+
+
+#if defined(CONFIG_HX_BUS_RECOVERY)
+
+static int lp5817_shadow_init(void)
+{
+    restore_hook.fn = lp5817_shadow_restore;
+    restore_hook.mux_chan = hx_mux_channel(HX_CLIENT_INDICATOR);
+    restore_hook.xfers = RESTORE_XFERS;
+    hx_bus_restore_register(&restore_hook);
+    return 0;
+}
+
+SYS_INIT(lp5817_shadow_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif
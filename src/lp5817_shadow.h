@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LP5817_SHADOW_H_
+#define LP5817_SHADOW_H_
+
+#include <stdint.h>
+#include <rgb_indicator.h>
+#include "lp5817_regs.h"
+
+/* What the LP5817 should hold right now, as far as the application knows. */
+struct lp5817_shadow {
+    uint8_t chip_en;
+    uint8_t dev_config0;
+    uint8_t dev_config1;
+    uint8_t dev_config2;                /* outputs handed to the engine, 0 = manual PWM */
+    uint8_t dc[LP5817_CHANNELS];
+    uint8_t pwm[LP5817_CHANNELS];       /* by output, color-mapping already applied */
+    uint8_t aeu[LP5817_CHANNELS][LP5817_AUTO_BYTES];
+};
+
+#if defined(CONFIG_LP5817_SHADOW)
+
+/** Record a color the driver has just written. */
+void lp5817_shadow_set_color(const struct led_rgb *color);
+
+/** Record an engine program (or dev_config2 = 0 for manual PWM) just written. */
+void lp5817_shadow_set_engine(uint8_t dev_config2, const uint8_t aeu[LP5817_CHANNELS][LP5817_AUTO_BYTES]);
+
+/** Record dot-current values (by output) just written. */
+void lp5817_shadow_set_dc(const uint8_t dc[LP5817_CHANNELS]);
+
+/** Copy of the current shadow. */
+void lp5817_shadow_get(struct lp5817_shadow *shadow);
+
+/**
+ * Rewrite the chip from the shadow. An hx_bus_fn_t: call with the HX bus held
+ * and the indicator's mux channel selected.
+ */
+int lp5817_shadow_restore(void *arg);
+
+#else
+
+static inline void lp5817_shadow_set_color(const struct led_rgb *color) { ARG_UNUSED(color); }
+static inline void lp5817_shadow_set_dc(const uint8_t dc[LP5817_CHANNELS]) { ARG_UNUSED(dc); }
+static inline void lp5817_shadow_set_engine(uint8_t dev_config2,
+                                            const uint8_t aeu[LP5817_CHANNELS][LP5817_AUTO_BYTES])
+{
+    ARG_UNUSED(dev_config2);
+    ARG_UNUSED(aeu);
+}
+
+#endif /* CONFIG_LP5817_SHADOW */
+
+#endif /* LP5817_SHADOW_H_ */
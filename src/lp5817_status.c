@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LP5817 fault status (open/short outputs, thermal shutdown, unexpected
+ * reset) without a polling thread. The status block is burst-read while the
+ * indicator already holds the bus for a color write, or from the interrupt
+ * line if the board wires one (gpio-keys child labelled rgbint). Changes are
+ * published to listeners, and open channels put the indicator into a
+ * degraded color remap.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lp5817_status, LOG_LEVEL_INF);
+
+#include "lp5817_status.h"
+#include "lp5817_regs.h"
+#include "lp5817_shadow.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+
+#define RGBCTRL_NODE DT_NODELABEL(rgbctrl)
+#define RGBINT_NODE DT_NODELABEL(rgbint)
+
+static const struct i2c_dt_spec lp5817 = I2C_DT_SPEC_GET(RGBCTRL_NODE);
+static const uint8_t color_map[LP5817_CHANNELS] = DT_PROP(RGBCTRL_NODE, color_mapping);
+
+/* Degraded mode: a lost channel's intensity moves to this one (red->blue, green->red, blue->green) */
+static const uint8_t substitute[LP5817_CHANNELS] = { 2, 0, 1 };
+
+static struct lp5817_status status;
+static struct k_spinlock lock;
+static sys_slist_t listeners;
+static uint16_t writes;
+
+
+static uint8_t outs_to_colors(uint8_t outs)
+{
+    uint8_t colors = 0;
+
+    for (int c = 0; c < LP5817_CHANNELS; c++)
+    {
+        if (outs & BIT(color_map[c]))
+        {
+            colors |= BIT(c);
+        }
+    }
+    return colors;
+}
+
+
+/* Bus held, indicator channel selected */
+static int status_read(void *arg)
+{
+    struct lp5817_status next = {0};
+    struct lp5817_status_listener *l;
+    uint8_t raw[3];
+    bool changed;
+    k_spinlock_key_t key;
+
+    ARG_UNUSED(arg);
+
+    if (i2c_burst_read_dt(&lp5817, LP5817_REG_FLAG, raw, sizeof(raw)) != 0)
+    {
+        return -EIO;
+    }
+    next.reset = (raw[0] & LP5817_FLAG_POR) != 0;
+    next.thermal = (raw[0] & LP5817_FLAG_TSD) != 0;
+    next.open = outs_to_colors(raw[1]);
+    next.shorted = outs_to_colors(raw[2]);
+
+    if (raw[0] & (LP5817_FLAG_POR | LP5817_FLAG_TSD))
+    {
+        (void)i2c_reg_write_byte_dt(&lp5817, LP5817_REG_FLAG_CLR, LP5817_FLAG_CLR_ALL);
+    }
+#if defined(CONFIG_LP5817_SHADOW)
+    if (next.reset)
+    {
+        LOG_WRN("LP5817 reset behind our back, restoring");
+        (void)lp5817_shadow_restore(NULL);
+    }
+#endif
+
+    key = k_spin_lock(&lock);
+    changed = next.open != status.open || next.shorted != status.shorted ||
+              next.thermal != status.thermal || next.reset;
+    status = next;
+    k_spin_unlock(&lock, key);
+
+    if (changed)
+    {
+        LOG_WRN("LP5817 open 0x%x short 0x%x%s%s", next.open, next.shorted,
+                next.thermal ? " TSD" : "", next.reset ? " POR" : "");
+        SYS_SLIST_FOR_EACH_CONTAINER(&listeners, l, node)
+        {
+            l->changed(&next);
+        }
+    }
+    return 0;
+}
+
+
+void lp5817_status_after_write(void)
+{
+    if (++writes < hx_bus_cadence(CONFIG_LP5817_STATUS_EVERY))
+    {
+        return;
+    }
+    writes = 0;
+    (void)status_read(NULL);
+}
+
+
+void lp5817_status_listen(struct lp5817_status_listener *listener)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    sys_slist_append(&listeners, &listener->node);
+    k_spin_unlock(&lock, key);
+}
+
+
+void lp5817_status_get(struct lp5817_status *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    *out = status;
+    k_spin_unlock(&lock, key);
+}
+
+
+struct led_rgb lp5817_status_remap(const struct led_rgb *color)
+{
+    uint8_t open = status.open;
+    uint8_t in[LP5817_CHANNELS] = { color->r, color->g, color->b };
+    uint8_t out[LP5817_CHANNELS] = { color->r, color->g, color->b };
+
+    if (open == 0)
+    {
+        return *color;
+    }
+    for (int c = 0; c < LP5817_CHANNELS; c++)
+    {
+        if (open & BIT(c))
+        {
+            uint8_t s = substitute[c];
+
+            out[c] = 0;
+            if (!(open & BIT(s)))
+            {
+                out[s] = MIN(255, out[s] + in[c]);
+            }
+        }
+    }
+    return (struct led_rgb){ .r = out[0], .g = out[1], .b = out[2] };
+}
+
+
+#if DT_NODE_HAS_STATUS(RGBINT_NODE, okay)
+
+static const struct gpio_dt_spec rgbint = GPIO_DT_SPEC_GET(RGBINT_NODE, gpios);
+static struct gpio_callback rgbint_cb;
+static struct hx_bus_txn rgbint_txn = { .client = HX_CLIENT_INDICATOR, .mux_chan = HX_MUX_NONE, .fn = status_read };
+static atomic_t rgbint_busy;
+
+
+static void rgbint_done(struct hx_bus_txn *txn, int result)
+{
+    ARG_UNUSED(txn);
+    ARG_UNUSED(result);
+    atomic_clear(&rgbint_busy);
+}
+
+
+static void rgbint_isr(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins)
+{
+    ARG_UNUSED(port);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+
+    if (atomic_cas(&rgbint_busy, 0, 1))
+    {
+        hx_bus_submit(&rgbint_txn);
+    }
+}
+
+
+static int lp5817_status_init(void)
+{
+    if (!gpio_is_ready_dt(&rgbint) ||
+        gpio_pin_configure_dt(&rgbint, GPIO_INPUT) < 0 ||
+        gpio_pin_interrupt_configure_dt(&rgbint, GPIO_INT_EDGE_TO_ACTIVE) < 0)
+    {
+        LOG_WRN("rgbint unavailable, status piggybacks on writes only");
+        return 0;
+    }
+    rgbint_txn.mux_chan = hx_mux_channel(HX_CLIENT_INDICATOR);
+    rgbint_txn.done = rgbint_done;
+    gpio_init_callback(&rgbint_cb, rgbint_isr, BIT(rgbint.pin));
+    return gpio_add_callback(rgbint.port, &rgbint_cb);
+}
+
+SYS_INIT(lp5817_status_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* rgbint */
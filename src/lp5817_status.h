@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LP5817_STATUS_H_
+#define LP5817_STATUS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/slist.h>
+#include <rgb_indicator.h>
+
+/* Fault state, channel bits are by color (bit 0 red, 1 green, 2 blue) */
+struct lp5817_status {
+    uint8_t open;
+    uint8_t shorted;
+    bool thermal;               /* thermal shutdown */
+    bool reset;                 /* chip saw a power-on reset since the last check */
+};
+
+struct lp5817_status_listener {
+    sys_snode_t node;
+    void (*changed)(const struct lp5817_status *status);   /* runs on the bus owner's thread */
+};
+
+#if defined(CONFIG_LP5817_STATUS)
+
+void lp5817_status_listen(struct lp5817_status_listener *listener);
+
+void lp5817_status_get(struct lp5817_status *status);
+
+/**
+ * Piggyback point: the indicator calls this with the bus held right after a
+ * color write; every CONFIG_LP5817_STATUS_EVERY writes (at 100 kHz, more at
+ * faster clocks, see hx_bus_cadence()) it reads the status block in one burst.
+ */
+void lp5817_status_after_write(void);
+
+/** Color to actually write given the known open channels. */
+struct led_rgb lp5817_status_remap(const struct led_rgb *color);
+
+#else
+
+static inline void lp5817_status_after_write(void) { }
+static inline struct led_rgb lp5817_status_remap(const struct led_rgb *color) { return *color; }
+
+#endif /* CONFIG_LP5817_STATUS */
+
+#endif /* LP5817_STATUS_H_ */
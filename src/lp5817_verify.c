@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sampled register read-back for production self-test. Every Nth color write
+ * the PWM registers are read back in the same bus hold and compared with the
+ * shadow; a full configuration check can run at boot. N is raised at init if
+ * needed so verification stays inside the configured share of indicator bus
+ * traffic. A mismatch is counted and repaired from the shadow.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/i2c.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lp5817_verify, LOG_LEVEL_INF);
+
+#include "lp5817_verify.h"
+#include "lp5817_regs.h"
+#include "lp5817_shadow.h"
+#include "hx_bus.h"
+#include "hx_mux.h"
+
+/* Register-address write plus a three byte read, with a repeated START */
+#define VERIFY_PWM_BYTES (2 + 1 + LP5817_CHANNELS)
+
+static const struct i2c_dt_spec lp5817 = I2C_DT_SPEC_GET(DT_NODELABEL(rgbctrl));
+
+static struct lp5817_verify_stats stats;
+static uint32_t writes;
+static uint32_t base_every;                         // at standard mode, hx_bus_cadence() scales it
+static struct hx_bus_txn boot_txn;
+
+
+static void mismatch(const char *what, const uint8_t *want, const uint8_t *got, size_t len)
+{
+    stats.mismatches++;
+    LOG_WRN("%s read-back mismatch: want %02x %02x %02x got %02x %02x %02x", what,
+            want[0], len > 1 ? want[1] : 0, len > 2 ? want[2] : 0,
+            got[0], len > 1 ? got[1] : 0, len > 2 ? got[2] : 0);
+    if (lp5817_shadow_restore(NULL) == 0)
+    {
+        stats.repaired++;
+    }
+}
+
+
+static int verify_block(const char *what, uint8_t reg, const uint8_t *want, size_t len)
+{
+    uint8_t got[LP5817_CHANNELS];
+
+    if (i2c_burst_read_dt(&lp5817, reg, got, len) != 0)
+    {
+        return -EIO;
+    }
+    if (memcmp(want, got, len) != 0)
+    {
+        mismatch(what, want, got, len);
+        return -EBADMSG;
+    }
+    return 0;
+}
+
+
+void lp5817_verify_after_write(void)
+{
+    struct lp5817_shadow s;
+
+    if (++writes < hx_bus_cadence(base_every))
+    {
+        return;
+    }
+    writes = 0;
+    stats.checks++;
+    lp5817_shadow_get(&s);
+    (void)verify_block("pwm", LP5817_REG_OUT0_PWM, s.pwm, LP5817_CHANNELS);
+}
+
+
+static void boot_done(struct hx_bus_txn *txn, int result)
+{
+    ARG_UNUSED(txn);
+    LOG_INF("Boot read-back %s (%d)", result == 0 ? "passed" : "FAILED", result);
+}
+
+
+int lp5817_verify_all(void *arg)
+{
+    struct lp5817_shadow s;
+    uint8_t cfg[3];
+    int ret;
+
+    ARG_UNUSED(arg);
+    lp5817_shadow_get(&s);
+    stats.checks++;
+
+    cfg[0] = s.chip_en;
+    cfg[1] = s.dev_config0;
+    cfg[2] = s.dev_config1;
+    ret = verify_block("config", LP5817_REG_CHIP_EN, cfg, sizeof(cfg));
+    if (ret == 0)
+    {
+        ret = verify_block("dot current", LP5817_REG_OUT0_DC, s.dc, LP5817_CHANNELS);
+    }
+    if (ret == 0)
+    {
+        ret = verify_block("pwm", LP5817_REG_OUT0_PWM, s.pwm, LP5817_CHANNELS);
+    }
+    return ret;
+}
+
+
+void lp5817_verify_stats_get(struct lp5817_verify_stats *out)
+{
+    *out = stats;
+    out->every = hx_bus_cadence(base_every);
+    out->overhead_ppm = VERIFY_PWM_BYTES * 1000000 / (out->every * LP5817_COLOR_FRAME_BYTES);
+}
+
+
+static int lp5817_verify_init(void)
+{
+    /* smallest N that keeps read-back under the budget: bytes / (N * frame) <= pct */
+    uint32_t min_every = DIV_ROUND_UP(VERIFY_PWM_BYTES * 100,
+                                      CONFIG_LP5817_VERIFY_MAX_OVERHEAD_PCT * LP5817_COLOR_FRAME_BYTES);
+
+    base_every = MAX(CONFIG_LP5817_VERIFY_EVERY, min_every);
+    if (base_every != CONFIG_LP5817_VERIFY_EVERY)
+    {
+        LOG_WRN("Read-back every %u writes to stay under %d%% bus overhead", base_every,
+                CONFIG_LP5817_VERIFY_MAX_OVERHEAD_PCT);
+    }
+
+    if (IS_ENABLED(CONFIG_LP5817_VERIFY_ON_BOOT))
+    {
+        boot_txn.client = HX_CLIENT_INDICATOR;                      // on the bus worker, not in the boot path
+        boot_txn.mux_chan = hx_mux_channel(HX_CLIENT_INDICATOR);
+        boot_txn.fn = lp5817_verify_all;
+        boot_txn.done = boot_done;
+        hx_bus_submit(&boot_txn);
+    }
+    return 0;
+}
+
+SYS_INIT(lp5817_verify_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LP5817_VERIFY_H_
+#define LP5817_VERIFY_H_
+
+#include <stdint.h>
+
+struct lp5817_verify_stats {
+    uint32_t checks;
+    uint32_t mismatches;
+    uint32_t repaired;
+    uint32_t every;             /* effective sampling interval, in color writes */
+    uint32_t overhead_ppm;      /* verification wire bytes / color wire bytes */
+};
+
+#if defined(CONFIG_LP5817_VERIFY)
+
+/** Called by the indicator with the bus held after each color write. */
+void lp5817_verify_after_write(void);
+
+/** Check every shadowed register now. An hx_bus_fn_t. */
+int lp5817_verify_all(void *arg);
+
+void lp5817_verify_stats_get(struct lp5817_verify_stats *stats);
+
+#else
+
+static inline void lp5817_verify_after_write(void) { }
+
+#endif /* CONFIG_LP5817_VERIFY */
+
+#endif /* LP5817_VERIFY_H_ */
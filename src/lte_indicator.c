@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * LTE link-state indicator profile. Link-controller events are folded into a
+ * handful of states and each state is shown from a const table. Blinking
+ * states go to the LP5817 engine (indicator_blink()) so the LED keeps its
+ * rhythm while the application core sleeps through PSM; on a backend without
+ * a hardware engine the same state falls back to a software pattern. Without
+ * the modem library (native_sim) a scripted stub feeds the same states.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lte_indicator, LOG_LEVEL_INF);
+
+#include "lte_indicator.h"
+#include "wake_align.h"
+#if defined(CONFIG_INDICATOR)
+#include "indicator.h"
+#endif
+#if defined(CONFIG_STATUS_CHAN)
+#include "status_chan.h"
+#endif
+#if defined(CONFIG_LTE_LINK_CONTROL)
+#include <modem/lte_lc.h>
+#endif
+
+struct lte_ind_profile {
+    const char *name;
+#if defined(CONFIG_INDICATOR)
+    struct led_rgb color;
+    uint16_t on_ms;
+    uint16_t off_ms;                    /* 0 = solid */
+    const struct indicator_pattern *fallback;
+#endif
+};
+
+#if defined(CONFIG_INDICATOR)
+
+INDICATOR_PATTERN(lte_pattern_searching, 0,
+    { RGB(0, 0, 100), 540 },
+    { RGB(0, 0, 0), 540 });
+
+INDICATOR_PATTERN(lte_pattern_registered, 0,
+    { RGB(0, 100, 0), 90 },
+    { RGB(0, 0, 0), 2500, 250 });
+
+INDICATOR_PATTERN(lte_pattern_edrx, 0,
+    { RGB(0, 100, 100), 90 },
+    { RGB(0, 0, 0), 5010, 500 });
+
+INDICATOR_PATTERN(lte_pattern_psm, 0,
+    { RGB(0, 40, 0), 90 },
+    { RGB(0, 0, 0), 8050, 800 });
+
+INDICATOR_PATTERN(lte_pattern_error, 0,
+    { RGB(100, 0, 0), 360 },
+    { RGB(0, 0, 0), 360 });
+
+#define PROFILE(_name, _color, _on, _off, _fallback) \
+    { .name = _name, .color = _color, .on_ms = _on, .off_ms = _off, .fallback = _fallback }
+#else
+#define PROFILE(_name, _color, _on, _off, _fallback) { .name = _name }
+#endif
+
+/* On/off times are engine time steps, so hardware and fallback blink alike */
+static const struct lte_ind_profile profiles[LTE_IND_COUNT] = {
+    [LTE_IND_OFF]        = PROFILE("off",        RGB(10, 10, 10), 0, 0, NULL),
+    [LTE_IND_SEARCHING]  = PROFILE("searching",  RGB(0, 0, 100), 540, 540, &lte_pattern_searching),
+    [LTE_IND_REGISTERED] = PROFILE("registered", RGB(0, 100, 0), 90, 2500, &lte_pattern_registered),
+    [LTE_IND_EDRX]       = PROFILE("edrx",       RGB(0, 100, 100), 90, 5010, &lte_pattern_edrx),
+    [LTE_IND_PSM]        = PROFILE("psm",        RGB(0, 40, 0), 90, 8050, &lte_pattern_psm),
+    [LTE_IND_ERROR]      = PROFILE("error",      RGB(100, 0, 0), 360, 360, &lte_pattern_error),
+};
+
+#if defined(CONFIG_STATUS_CHAN)
+static const uint8_t status_conn[LTE_IND_COUNT] = {
+    [LTE_IND_OFF] = STATUS_CONN_OFFLINE,
+    [LTE_IND_SEARCHING] = STATUS_CONN_SEARCHING,
+    [LTE_IND_REGISTERED] = STATUS_CONN_CONNECTED,
+    [LTE_IND_EDRX] = STATUS_CONN_CONNECTED,
+    [LTE_IND_PSM] = STATUS_CONN_CONNECTED,
+    [LTE_IND_ERROR] = STATUS_CONN_ERROR,
+};
+#endif
+
+static enum lte_ind_state current = LTE_IND_COUNT;      // nothing shown yet
+static bool edrx_active;
+
+
+static void show(const struct lte_ind_profile *p)
+{
+#if defined(CONFIG_INDICATOR)
+    int ret;
+
+    if (p->off_ms == 0)
+    {
+        indicator_set_color(&p->color);
+        LOG_INF("LTE %s: solid", p->name);
+        return;
+    }
+    ret = indicator_blink(&p->color, p->on_ms, p->off_ms);
+    if (ret == 0)
+    {
+        LOG_INF("LTE %s: engine blink %u/%u ms", p->name, p->on_ms, p->off_ms);
+    }
+    else if (ret == -ENOTSUP)
+    {
+        indicator_play(p->fallback);                    // no engine, the CPU keeps the rhythm
+        LOG_INF("LTE %s: software pattern", p->name);
+    }
+    else
+    {
+        LOG_WRN("LTE %s: blink failed (%d)", p->name, ret);
+    }
+#else
+    LOG_INF("LTE %s", p->name);
+#endif
+}
+
+
+void lte_indicator_set(enum lte_ind_state state)
+{
+    if (state >= LTE_IND_COUNT || state == current)
+    {
+        return;
+    }
+    if (state == LTE_IND_REGISTERED && edrx_active)
+    {
+        state = LTE_IND_EDRX;
+    }
+
+    current = state;
+    show(&profiles[state]);
+
+#if defined(CONFIG_STATUS_CHAN)
+    (void)status_publish_conn(status_conn[state]);      // for other status consumers
+#endif
+}
+
+
+enum lte_ind_state lte_indicator_state(void)
+{
+    return current;
+}
+
+
+const char *lte_indicator_state_name(enum lte_ind_state state)
+{
+    return state < LTE_IND_COUNT ? profiles[state].name : "?";
+}
+
+
+#if defined(CONFIG_LTE_LINK_CONTROL)
+
+/*
+ * The modem's eDRX paging cycle, anchored at the update event. Only a rough
+ * phase, but the app core sees modem traffic on that rhythm.
+ */
+static struct wake_source edrx_wake = { .name = "edrx" };
+
+
+static void lte_handler(const struct lte_lc_evt *const evt)
+{
+    switch (evt->type)
+    {
+    case LTE_LC_EVT_NW_REG_STATUS:
+        switch (evt->nw_reg_status)
+        {
+        case LTE_LC_NW_REG_REGISTERED_HOME:
+        case LTE_LC_NW_REG_REGISTERED_ROAMING:
+            lte_indicator_set(LTE_IND_REGISTERED);
+            break;
+        case LTE_LC_NW_REG_SEARCHING:
+            lte_indicator_set(LTE_IND_SEARCHING);
+            break;
+        case LTE_LC_NW_REG_REGISTRATION_DENIED:
+        case LTE_LC_NW_REG_UICC_FAIL:
+            lte_indicator_set(LTE_IND_ERROR);
+            break;
+        default:
+            lte_indicator_set(LTE_IND_OFF);
+            break;
+        }
+        break;
+
+    case LTE_LC_EVT_EDRX_UPDATE:
+        edrx_active = evt->edrx_cfg.edrx > 0.0f;
+        if (edrx_active)
+        {
+            k_ticks_t period = k_ms_to_ticks_ceil64((uint32_t)(evt->edrx_cfg.edrx * MSEC_PER_SEC));
+
+            wake_align_note(&edrx_wake, k_uptime_ticks() + period, period);
+        }
+        else
+        {
+            wake_align_note(&edrx_wake, 0, 0);
+        }
+        if (current == LTE_IND_REGISTERED || current == LTE_IND_EDRX)
+        {
+            current = LTE_IND_COUNT;                    // re-evaluate registered vs eDRX
+            lte_indicator_set(LTE_IND_REGISTERED);
+        }
+        break;
+
+#if defined(CONFIG_LTE_LC_MODEM_SLEEP_NOTIFICATIONS)
+    case LTE_LC_EVT_MODEM_SLEEP_ENTER:
+        if (evt->modem_sleep.type == LTE_LC_MODEM_SLEEP_PSM)
+        {
+            lte_indicator_set(LTE_IND_PSM);
+        }
+        break;
+
+    case LTE_LC_EVT_MODEM_SLEEP_EXIT:
+        if (current == LTE_IND_PSM)
+        {
+            lte_indicator_set(LTE_IND_REGISTERED);
+        }
+        break;
+#endif
+
+    default:
+        break;
+    }
+}
+
+
+static int lte_indicator_init(void)
+{
+    wake_align_register(&edrx_wake);
+    lte_lc_register_handler(lte_handler);
+    return 0;
+}
+
+SYS_INIT(lte_indicator_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* CONFIG_LTE_LINK_CONTROL */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LTE_INDICATOR_H_
+#define LTE_INDICATOR_H_
+
+enum lte_ind_state {
+    LTE_IND_OFF,
+    LTE_IND_SEARCHING,
+    LTE_IND_REGISTERED,
+    LTE_IND_EDRX,               /* registered, eDRX granted */
+    LTE_IND_PSM,                /* modem asleep in PSM */
+    LTE_IND_ERROR,
+    LTE_IND_COUNT
+};
+
+/**
+ * Show a link state. Fed by the lte_lc handler on hardware and by the
+ * scripted stub elsewhere. Thread context only.
+ */
+void lte_indicator_set(enum lte_ind_state state);
+
+enum lte_ind_state lte_indicator_state(void);
+
+const char *lte_indicator_state_name(enum lte_ind_state state);
+
+#endif /* LTE_INDICATOR_H_ */
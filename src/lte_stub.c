@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Scripted LTE event source for builds without the modem library (native_sim):
+ * walks a typical attach, eDRX, PSM and failure sequence through
+ * lte_indicator_set() from the system work queue, then starts over.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+
+#include "lte_indicator.h"
+
+struct stub_step {
+    enum lte_ind_state state;
+    uint16_t hold_ms;
+};
+
+static const struct stub_step script[] = {
+    { LTE_IND_OFF, 1000 },
+    { LTE_IND_SEARCHING, 4000 },
+    { LTE_IND_REGISTERED, 3000 },
+    { LTE_IND_EDRX, 5000 },
+    { LTE_IND_PSM, 10000 },
+    { LTE_IND_REGISTERED, 2000 },
+    { LTE_IND_SEARCHING, 2000 },
+    { LTE_IND_ERROR, 3000 },
+};
+
+static struct k_work_delayable stub_work;
+static size_t pos;
+
+
+static void stub_handler(struct k_work *work)
+{
+    const struct stub_step *step = &script[pos];
+
+    ARG_UNUSED(work);
+    lte_indicator_set(step->state);
+    pos = (pos + 1) % ARRAY_SIZE(script);
+    k_work_schedule(&stub_work, K_MSEC(step->hold_ms));
+}
+
+
+static int lte_stub_init(void)
+{
+    k_work_init_delayable(&stub_work, stub_handler);
+    k_work_schedule(&stub_work, K_NO_WAIT);
+    return 0;
+}
+
+SYS_INIT(lte_stub_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -12,6 +12,11 @@
 LOG_MODULE_REGISTER(rgbi, LOG_LEVEL_INF);
 
 #include <rgb_indicator.h>
+#if defined(CONFIG_INDICATOR)
+#include "indicator.h"
+#else
+#define indicator_restored() false
+#endif
 
 #define LOOP_SLEEP_MS 1000
 #define COLOR_SLEEP_MS 500
@@ -20,9 +25,17 @@ LOG_MODULE_REGISTER(rgbi, LOG_LEVEL_INF);
 #define HXCTRL_NODE DT_NODELABEL(hxctrl)
 #define RGBCTRL_NODE DT_NODELABEL(rgbctrl)
 
+#define HAS_HX_PINS (DT_NODE_EXISTS(HXRQST_NODE) && DT_NODE_EXISTS(HXCTRL_NODE) && \
+                     !IS_ENABLED(CONFIG_INDICATOR_SYNC))                        // MTC.2 boards, not the DK; sync owns them
+#define HAS_RGBI (!IS_ENABLED(CONFIG_INDICATOR) && DT_NODE_HAS_STATUS(RGBCTRL_NODE, okay))  // no LED on native_sim
+
+#if HAS_HX_PINS
 static const struct gpio_dt_spec hxrqst = GPIO_DT_SPEC_GET(HXRQST_NODE, gpios);
 static const struct gpio_dt_spec hxctrl = GPIO_DT_SPEC_GET(HXCTRL_NODE, gpios);
+#endif
+#if HAS_RGBI
 static const struct device *const rgbi = DEVICE_DT_GET(RGBCTRL_NODE);
+#endif
 
 // #define BMP_NODE DT_NODELABEL(bmp)
 // #define SHT_NODE DT_NODELABEL(sht)
@@ -52,6 +65,18 @@ static const struct led_rgb colors[] = {
     RGB(0, 0, 0)
 };
 
+static void show_color(const struct led_rgb *color)
+{
+#if defined(CONFIG_INDICATOR)
+    indicator_set_color(color);                                                 // whichever backend this board has
+#elif HAS_RGBI
+    rgbi_set_color(rgbi, color);
+#else
+    ARG_UNUSED(color);
+#endif
+}
+
+
 int main(void)
 {
     int ret;
@@ -59,9 +84,9 @@ int main(void)
 
     printf("Hello %s, welcome to the IoT world and watch out for green flashes on the horizon! \r\n", CONFIG_BOARD_TARGET);
 
+#if HAS_HX_PINS
     if (!gpio_is_ready_dt(&hxrqst) ||
-        !gpio_is_ready_dt(&hxctrl) ||
-        !device_is_ready(rgbi)
+        !gpio_is_ready_dt(&hxctrl)
        )
     {
         LOG_ERR("Required devices not ready");
@@ -75,15 +100,24 @@ int main(void)
         LOG_ERR("Unable to configure I/O");
         return 0;
     }
+#endif
+#if HAS_RGBI
+    if (!device_is_ready(rgbi))
+    {
+        LOG_ERR("Required devices not ready");
+        return 0;
+    }
+#endif
 
-    for (size_t i = 0; i < sizeof(colors)/sizeof(struct led_rgb); i++)       // cycle through primary/secondary colors
+    for (size_t i = 0; i < sizeof(colors)/sizeof(struct led_rgb) && !indicator_restored(); i++)   // cycle through primary/secondary colors
     {
-        rgbi_set_color(rgbi, &colors[i]);
+        show_color(&colors[i]);
         k_msleep(COLOR_SLEEP_MS);
     }
 
     while (1)
     {
+#if HAS_HX_PINS
         ret =  gpio_pin_toggle_dt(&hxrqst) < 0 ? 1 : 0;
         ret += gpio_pin_toggle_dt(&hxctrl) < 0 ? 1 : 0;
         if (ret != 0)
@@ -91,11 +125,17 @@ int main(void)
             LOG_ERR("I/O error on pin output");
             return 0;
         }
+#endif
 
         loopcount++;
 
         int colorIndx = loopcount % (sizeof(colors)/sizeof(struct led_rgb));
-        rgbi_set_color(rgbi, &colors[colorIndx]);
+        if (!IS_ENABLED(CONFIG_SENSOR_COLOR_MAP) &&                             // sensor stage owns the LED
+            !IS_ENABLED(CONFIG_INDICATOR_STATUS) &&                             // or system status does
+            !IS_ENABLED(CONFIG_LTE_INDICATOR))                                  // or the LTE link state
+        {
+            show_color(&colors[colorIndx]);
+        }
 
         printf("Loops: %d (%d)\n", loopcount, colorIndx);
         k_msleep(LOOP_SLEEP_MS);
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Standard Zephyr LED and LED strip front ends for the indicator, so generic
+ * code can drive it through led_set_color()/led_blink() on "rgbi_led" or
+ * led_strip_update_rgb() on "rgbi_strip". Both go through the indicator
+ * worker, and led_blink() runs on the LP5817 engine rather than a timer.
+ * One LED, index 0, three colors.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/led.h>
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/dt-bindings/led/led.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(rgbi_led, LOG_LEVEL_INF);
+
+#include "indicator.h"
+
+#define RGBI_LED_COLORS 3
+
+static const uint8_t color_mapping[RGBI_LED_COLORS] = { LED_COLOR_ID_RED, LED_COLOR_ID_GREEN, LED_COLOR_ID_BLUE };
+
+static const struct led_info info = {
+    .label = "rgbi",
+    .index = 0,
+    .num_colors = RGBI_LED_COLORS,
+    .color_mapping = color_mapping,
+};
+
+/* led API state: color as set, shown scaled by brightness */
+static struct led_rgb color = RGB(0xFF, 0xFF, 0xFF);
+static uint8_t brightness = LED_BRIGHTNESS_MAX;
+
+
+static struct led_rgb scaled(void)
+{
+    struct led_rgb out = {
+        .r = color.r * brightness / LED_BRIGHTNESS_MAX,
+        .g = color.g * brightness / LED_BRIGHTNESS_MAX,
+        .b = color.b * brightness / LED_BRIGHTNESS_MAX,
+    };
+
+    return out;
+}
+
+
+static int rgbi_led_set_brightness(const struct device *dev, uint32_t led, uint8_t value)
+{
+    struct led_rgb out;
+
+    ARG_UNUSED(dev);
+    if (led != 0 || value > LED_BRIGHTNESS_MAX)
+    {
+        return -EINVAL;
+    }
+    brightness = value;
+    out = scaled();
+    indicator_set_color(&out);
+    return 0;
+}
+
+
+static int rgbi_led_on(const struct device *dev, uint32_t led)
+{
+    return rgbi_led_set_brightness(dev, led, LED_BRIGHTNESS_MAX);
+}
+
+
+static int rgbi_led_off(const struct device *dev, uint32_t led)
+{
+    return rgbi_led_set_brightness(dev, led, 0);
+}
+
+
+static int rgbi_led_set_color(const struct device *dev, uint32_t led, uint8_t num_colors, const uint8_t *levels)
+{
+    struct led_rgb out;
+
+    ARG_UNUSED(dev);
+    if (led != 0 || num_colors != RGBI_LED_COLORS)
+    {
+        return -EINVAL;
+    }
+    color.r = levels[0];
+    color.g = levels[1];
+    color.b = levels[2];
+    out = scaled();
+    indicator_set_color(&out);
+    return 0;
+}
+
+
+static int rgbi_led_blink(const struct device *dev, uint32_t led, uint32_t delay_on, uint32_t delay_off)
+{
+    struct led_rgb out;
+
+    ARG_UNUSED(dev);
+    if (led != 0)
+    {
+        return -EINVAL;
+    }
+    out = scaled();
+    return indicator_blink(&out, delay_on, delay_off);
+}
+
+
+static int rgbi_led_get_info(const struct device *dev, uint32_t led, const struct led_info **out)
+{
+    ARG_UNUSED(dev);
+    if (led != 0)
+    {
+        return -EINVAL;
+    }
+    *out = &info;
+    return 0;
+}
+
+
+static const struct led_driver_api rgbi_led_api = {
+    .on = rgbi_led_on,
+    .off = rgbi_led_off,
+    .blink = rgbi_led_blink,
+    .get_info = rgbi_led_get_info,
+    .set_brightness = rgbi_led_set_brightness,
+    .set_color = rgbi_led_set_color,
+};
+
+DEVICE_DEFINE(rgbi_led, "rgbi_led", NULL, NULL, NULL, NULL,
+              APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY, &rgbi_led_api);
+
+
+static int rgbi_strip_update_rgb(const struct device *dev, struct led_rgb *pixels, size_t num_pixels)
+{
+    ARG_UNUSED(dev);
+    if (num_pixels == 0)
+    {
+        return -EINVAL;
+    }
+    indicator_set_color(&pixels[0]);                    // a strip of one, extra pixels are ignored
+    return 0;
+}
+
+
+static int rgbi_strip_update_channels(const struct device *dev, uint8_t *channels, size_t num_channels)
+{
+    ARG_UNUSED(dev);
+    ARG_UNUSED(channels);
+    ARG_UNUSED(num_channels);
+    return -ENOTSUP;
+}
+
+
+static size_t rgbi_strip_length(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+    return 1;
+}
+
+
+static const struct led_strip_driver_api rgbi_strip_api = {
+    .update_rgb = rgbi_strip_update_rgb,
+    .update_channels = rgbi_strip_update_channels,
+    .length = rgbi_strip_length,
+};
+
+DEVICE_DEFINE(rgbi_strip, "rgbi_strip", NULL, NULL, NULL, NULL,
+              APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY, &rgbi_strip_api);
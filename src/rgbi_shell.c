@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * "rgbi" shell commands for tuning and profiling the indicator on a live unit:
+ * colors and patterns, the LP5817 shadow, counters, the bus benchmark and a
+ * trace of the next N HX bus transactions. Subcommands appear only when the
+ * feature behind them is built in.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include "indicator.h"
+#include "hx_bus.h"
+#include "lp5817_regs.h"
+#if defined(CONFIG_LP5817_SHADOW)
+#include "lp5817_shadow.h"
+#endif
+#if defined(CONFIG_HX_BENCH)
+#include "hx_bench.h"
+#endif
+#if defined(CONFIG_LP5817_VERIFY)
+#include "lp5817_verify.h"
+#endif
+#if defined(CONFIG_INDICATOR_BRIGHTNESS)
+#include "brightness.h"
+#endif
+#include "indicator_sync.h"
+#include "indicator_health.h"
+
+#define BENCH_FRAMES_DEFAULT 200
+
+
+static int cmd_color(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long rgb[3];
+    struct led_rgb color;
+    int err = 0;
+
+    ARG_UNUSED(argc);
+    for (size_t i = 0; i < ARRAY_SIZE(rgb); i++)
+    {
+        rgb[i] = shell_strtoul(argv[1 + i], 0, &err);
+        if (err == 0 && rgb[i] > UINT8_MAX)
+        {
+            err = -ERANGE;                              // would wrap in the uint8_t channel
+        }
+    }
+    if (err != 0)
+    {
+        shell_error(sh, "usage: rgbi color <r> <g> <b>, each 0-255");
+        return -EINVAL;
+    }
+    color.r = rgb[0];
+    color.g = rgb[1];
+    color.b = rgb[2];
+    indicator_set_color(&color);
+    return 0;
+}
+
+
+static int cmd_play(const struct shell *sh, size_t argc, char **argv)
+{
+    const struct indicator_pattern *pattern = indicator_pattern_find(argv[1]);
+
+    ARG_UNUSED(argc);
+    if (pattern == NULL)
+    {
+        shell_error(sh, "no pattern \"%s\", see rgbi patterns", argv[1]);
+        return -ENOENT;
+    }
+    indicator_play(pattern);
+    return 0;
+}
+
+
+static int cmd_stop(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(sh);
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    indicator_stop();
+    return 0;
+}
+
+
+static int cmd_patterns(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    STRUCT_SECTION_FOREACH(indicator_pattern, p)
+    {
+        shell_print(sh, "%-24s %u steps, repeat %u", p->name, p->count, p->repeat);
+    }
+    return 0;
+}
+
+
+#if defined(CONFIG_LP5817_SHADOW)
+static int cmd_shadow(const struct shell *sh, size_t argc, char **argv)
+{
+    struct lp5817_shadow s;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    lp5817_shadow_get(&s);
+    shell_print(sh, "chip_en %02x  dev_config0 %02x  dev_config1 %02x  dev_config2 %02x",
+                s.chip_en, s.dev_config0, s.dev_config1, s.dev_config2);
+    shell_print(sh, "dc  %02x %02x %02x", s.dc[0], s.dc[1], s.dc[2]);
+    shell_print(sh, "pwm %02x %02x %02x", s.pwm[0], s.pwm[1], s.pwm[2]);
+    if (s.dev_config2 != 0)
+    {
+        for (int i = 0; i < LP5817_CHANNELS; i++)
+        {
+            shell_hexdump_line(sh, LP5817_REG_OUT0_AUTO + i * LP5817_AUTO_BYTES, s.aeu[i], LP5817_AUTO_BYTES);
+        }
+    }
+    return 0;
+}
+#endif
+
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+    struct indicator_stats st;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    indicator_stats_get(&st);
+    shell_print(sh, "indicator: plays %u writes %u errors %u latency %u us (max %u) boot %u us",
+                st.plays, st.writes, st.errors, st.lat_last_us, st.lat_max_us, st.boot_us);
+#if defined(CONFIG_INDICATOR_EDF)
+    shell_print(sh, "deadlines: met %u missed %u dropped %u, worst %u us late",
+                st.deadline_met, st.deadline_missed, st.deadline_dropped, st.late_max_us);
+#endif
+#if defined(CONFIG_HX_BUS)
+    shell_print(sh, "hx bus: %u Hz, color frame %u us", hx_bus_bitrate(), hx_bus_xfer_us(LP5817_COLOR_FRAME_BYTES));
+#endif
+
+#if defined(CONFIG_HX_BUS_LOCK_STATS)
+    for (int c = 0; c < HX_CLIENT_COUNT; c++)
+    {
+        struct hx_bus_client_stats cs;
+
+        hx_bus_stats_get(c, &cs);
+        if (cs.wait.count != 0)
+        {
+            shell_print(sh, "  %-9s n=%u wait max %u us, hold max %u us", hx_bus_client_name(c),
+                        cs.wait.count, cs.wait.max_us, cs.hold.max_us);
+        }
+    }
+#endif
+#if defined(CONFIG_HX_BUS_RECOVERY)
+    struct hx_bus_fault_stats fs;
+
+    hx_bus_fault_stats_get(&fs);
+    shell_print(sh, "faults %u retries %u clears %u recovered %u failed %u, recovery %u us (max %u)",
+                fs.faults, fs.retries, fs.bus_clears, fs.recovered, fs.failed, fs.last_us, fs.max_us);
+#endif
+#if defined(CONFIG_LP5817_VERIFY)
+    struct lp5817_verify_stats vs;
+
+    lp5817_verify_stats_get(&vs);
+    shell_print(sh, "read-back: checks %u mismatches %u repaired %u, every %u writes",
+                vs.checks, vs.mismatches, vs.repaired, vs.every);
+#endif
+#if defined(CONFIG_INDICATOR_BRIGHTNESS)
+    struct brightness_stats bs;
+
+    brightness_stats_get(&bs);
+    shell_print(sh, "brightness: scale %u/256 (dc %u, lut %u), changes %u, dc only %u",
+                bs.factor, bs.hw_scale, bs.lut_scale, bs.changes, bs.hw_only);
+#endif
+#if defined(CONFIG_INDICATOR_SYNC)
+    struct indicator_sync_stats ss;
+
+    indicator_sync_stats_get(&ss);
+    shell_print(sh, "sync: %s, %u edges (%u missed, %u glitches), phase error %d us (max %u), period %d ppm, "
+                "%u passes aligned", ss.locked ? "locked" : "unlocked", ss.edges, ss.missed, ss.glitches, ss.err_us,
+                ss.err_max_us, ss.period_ppm, ss.aligned);
+#endif
+#if defined(CONFIG_INDICATOR_HEALTH)
+    struct indicator_health_stats hs;
+
+    indicator_health_stats_get(&hs);
+    shell_print(sh, "health: stalls %u recovered %u, recovery %u us (max %u), missed ticks %u (worst %u ms)",
+                hs.stalls, hs.recovered, hs.recovery_last_us, hs.recovery_max_us, hs.missed_ticks, hs.late_max_ms);
+#endif
+    return 0;
+}
+
+
+#if defined(CONFIG_HX_BENCH)
+static int cmd_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    struct hx_bench_result res[3];
+    uint32_t frames = BENCH_FRAMES_DEFAULT;
+    int err = 0;
+    size_t n;
+
+    if (argc > 1)
+    {
+        frames = shell_strtoul(argv[1], 0, &err);
+        if (err != 0 || frames == 0)
+        {
+            shell_error(sh, "usage: rgbi bench [frames]");
+            return -EINVAL;
+        }
+    }
+    n = hx_bench_run(frames, res, ARRAY_SIZE(res));
+    for (size_t i = 0; i < n; i++)
+    {
+        if (res[i].status != 0)
+        {
+            shell_print(sh, "%7u Hz: not supported (%d)", res[i].bitrate, res[i].status);
+            continue;
+        }
+        shell_print(sh, "%7u Hz: %u frames/s, %u us/frame, bus %u%% busy", res[i].bitrate,
+                    res[i].frames_per_s, res[i].frame_us, res[i].occupancy_pct);
+    }
+    return 0;
+}
+#endif
+
+
+#if defined(CONFIG_HX_BUS_TRACE)
+static int cmd_trace(const struct shell *sh, size_t argc, char **argv)
+{
+    static struct hx_bus_trace_entry entries[CONFIG_HX_BUS_TRACE_DEPTH];
+    uint16_t armed;
+    size_t n;
+    int err = 0;
+
+    if (argc > 1)
+    {
+        unsigned long count = shell_strtoul(argv[1], 0, &err);
+
+        if (err != 0 || count == 0 || count > UINT16_MAX)
+        {
+            shell_error(sh, "usage: rgbi trace [count], count 1-%u", UINT16_MAX);
+            return -EINVAL;
+        }
+        hx_bus_trace_arm(count);
+        shell_print(sh, "tracing the next %u transactions, \"rgbi trace\" to show",
+                    (uint16_t)MIN(count, CONFIG_HX_BUS_TRACE_DEPTH));
+        return 0;
+    }
+
+    n = hx_bus_trace_get(entries, ARRAY_SIZE(entries), &armed);
+    for (size_t i = 0; i < n; i++)
+    {
+        shell_print(sh, "%10u us  %-9s ch %3u  fn %p  %5u us  %d", entries[i].at_us,
+                    hx_bus_client_name(entries[i].client), entries[i].mux_chan, (void *)entries[i].fn,
+                    entries[i].dur_us, entries[i].result);
+    }
+    shell_print(sh, "%zu captured, %u to go", n, armed);
+    return 0;
+}
+#endif
+
+
+SHELL_STATIC_SUBCMD_SET_CREATE(rgbi_cmds,
+    SHELL_CMD_ARG(color, NULL, "Show a solid color: <r> <g> <b>", cmd_color, 4, 0),
+    SHELL_CMD_ARG(play, NULL, "Play a pattern: <name>", cmd_play, 2, 0),
+    SHELL_CMD(stop, NULL, "Stop the current pattern", cmd_stop),
+    SHELL_CMD(patterns, NULL, "List patterns", cmd_patterns),
+#if defined(CONFIG_LP5817_SHADOW)
+    SHELL_CMD(shadow, NULL, "Dump the LP5817 shadow registers", cmd_shadow),
+#endif
+    SHELL_CMD(stats, NULL, "Dump indicator and HX bus counters", cmd_stats),
+#if defined(CONFIG_HX_BENCH)
+    SHELL_CMD_ARG(bench, NULL, "Color frame rate at each bus speed: [frames]", cmd_bench, 1, 1),
+#endif
+#if defined(CONFIG_HX_BUS_TRACE)
+    SHELL_CMD_ARG(trace, NULL, "Trace the next [count] HX bus transactions, or show the trace", cmd_trace, 1, 1),
+#endif
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(rgbi, &rgbi_cmds, "RGB indicator tuning and profiling", NULL);
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSOR_Q31_H_
+#define SENSOR_Q31_H_
+
+#include <stdint.h>
+#include <zephyr/dsp/types.h>
+
+/* q31 with shift -> value * 1000 (degC -> mdegC, kPa -> Pa, % -> m%, m/s^2 -> mm/s^2) */
+static inline int32_t q31_to_milli(q31_t value, int8_t shift)
+{
+    int64_t v = (int64_t)value * 1000;
+
+    v = shift >= 0 ? v << shift : v >> -shift;
+    return (int32_t)(v >> 31);
+}
+
+#endif /* SENSOR_Q31_H_ */
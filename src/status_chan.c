@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * System status channels. Observers attach from their own modules with
+ * ZBUS_CHAN_ADD_OBS, so nothing here knows who is listening.
+ */
+
+#include <zephyr/zbus/zbus.h>
+
+#include "status_chan.h"
+
+ZBUS_CHAN_DEFINE(status_conn_chan, struct status_conn_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.state = STATUS_CONN_OFFLINE));
+
+ZBUS_CHAN_DEFINE(status_battery_chan, struct status_battery_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(.percent = 100));
+
+ZBUS_CHAN_DEFINE(status_fault_chan, struct status_fault_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * System status Zbus channels. Publishers stamp each message with
+ * k_cycle_get_32() (the status_publish_*() helpers do) so consumers can
+ * measure message-to-output latency.
+ */
+
+#ifndef STATUS_CHAN_H_
+#define STATUS_CHAN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+
+#define STATUS_PUBLISH_TIMEOUT K_MSEC(10)
+
+enum status_conn {
+    STATUS_CONN_OFFLINE,
+    STATUS_CONN_SEARCHING,
+    STATUS_CONN_CONNECTED,
+    STATUS_CONN_ERROR,
+    STATUS_CONN_COUNT
+};
+
+struct status_conn_msg {
+    uint8_t state;              /* enum status_conn */
+    uint32_t cycles;
+};
+
+struct status_battery_msg {
+    uint8_t percent;
+    bool charging;
+    uint32_t cycles;
+};
+
+struct status_fault_msg {
+    uint16_t code;              /* application defined, 0 = none */
+    bool active;
+    uint32_t cycles;
+};
+
+ZBUS_CHAN_DECLARE(status_conn_chan, status_battery_chan, status_fault_chan);
+
+
+static inline int status_publish_conn(enum status_conn state)
+{
+    struct status_conn_msg msg = { .state = state, .cycles = k_cycle_get_32() };
+
+    return zbus_chan_pub(&status_conn_chan, &msg, STATUS_PUBLISH_TIMEOUT);
+}
+
+static inline int status_publish_battery(uint8_t percent, bool charging)
+{
+    struct status_battery_msg msg = { .percent = percent, .charging = charging, .cycles = k_cycle_get_32() };
+
+    return zbus_chan_pub(&status_battery_chan, &msg, STATUS_PUBLISH_TIMEOUT);
+}
+
+static inline int status_publish_fault(uint16_t code, bool active)
+{
+    struct status_fault_msg msg = { .code = code, .active = active, .cycles = k_cycle_get_32() };
+
+    return zbus_chan_pub(&status_fault_chan, &msg, STATUS_PUBLISH_TIMEOUT);
+}
+
+#endif /* STATUS_CHAN_H_ */
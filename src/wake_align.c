@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Wakeup alignment. Modules with wakeups of their own (the sensor sampler, the
+ * modem's eDRX/PSM rhythm) register them as sources; a timer that can slip a
+ * little asks wake_align_delay() and is moved onto the first known wakeup in
+ * its window, so the CPU leaves idle once for both instead of twice. Idle
+ * residency is accumulated separately with alignment on and off, and
+ * CONFIG_WAKE_ALIGN_AB_PERIOD_S flips between the two to compare them.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(wake_align, LOG_LEVEL_INF);
+
+#include "wake_align.h"
+
+static sys_slist_t sources = SYS_SLIST_STATIC_INIT(&sources);
+static struct wake_align_stats stats = { .enabled = true };
+static k_thread_runtime_stats_t checkpoint;
+static struct k_spinlock lock;
+
+
+/* Close the current mode's residency window. Call with the lock held. */
+static void residency_account(void)
+{
+    struct wake_align_mode_stats *m = &stats.mode[stats.enabled];
+    k_thread_runtime_stats_t now;
+
+    k_thread_runtime_stats_all_get(&now);
+    m->idle_cycles += now.idle_cycles - checkpoint.idle_cycles;
+    m->all_cycles += now.execution_cycles - checkpoint.execution_cycles;
+    m->residency_ppm = m->all_cycles == 0 ? 0 : (uint32_t)(m->idle_cycles * 1000000 / m->all_cycles);
+    checkpoint = now;
+}
+
+
+void wake_align_register(struct wake_source *src)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    sys_slist_append(&sources, &src->node);
+    k_spin_unlock(&lock, key);
+}
+
+
+void wake_align_note(struct wake_source *src, k_ticks_t next, k_ticks_t period)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    src->next = next;
+    src->period = period;
+    k_spin_unlock(&lock, key);
+}
+
+
+k_timeout_t wake_align_delay(uint32_t delay_us, uint32_t slack_ms)
+{
+    k_ticks_t target = k_uptime_ticks() + (k_ticks_t)k_us_to_ticks_ceil64(delay_us);
+    k_ticks_t limit = target + (k_ticks_t)k_ms_to_ticks_floor64(slack_ms);
+    k_ticks_t best = limit + 1;
+    struct wake_source *src;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    stats.mode[stats.enabled].ticks++;
+    if (!stats.enabled || slack_ms == 0)
+    {
+        k_spin_unlock(&lock, key);
+        return K_TIMEOUT_ABS_TICKS(target);
+    }
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&sources, src, node)
+    {
+        k_ticks_t at = src->next;
+
+        if (at < target && src->period > 0)
+        {
+            at += DIV_ROUND_UP(target - at, src->period) * src->period;     // first occurrence in the window
+        }
+        if (at >= target && at < best)
+        {
+            best = at;
+        }
+    }
+    if (best <= limit)
+    {
+        stats.mode[1].aligned++;
+        target = best;
+    }
+    k_spin_unlock(&lock, key);
+
+    return K_TIMEOUT_ABS_TICKS(target);
+}
+
+
+void wake_align_set_enabled(bool enabled)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    residency_account();
+    stats.enabled = enabled;
+    k_spin_unlock(&lock, key);
+}
+
+
+void wake_align_stats_get(struct wake_align_stats *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    residency_account();
+    *out = stats;
+    k_spin_unlock(&lock, key);
+}
+
+
+#if CONFIG_WAKE_ALIGN_AB_PERIOD_S > 0
+
+static struct k_work_delayable ab_work;
+
+
+static void ab_handler(struct k_work *work)
+{
+    struct wake_align_stats s;
+
+    ARG_UNUSED(work);
+    wake_align_stats_get(&s);
+    LOG_INF("Idle residency: free running %u ppm (%u ticks), aligned %u ppm (%u/%u ticks aligned)",
+            s.mode[0].residency_ppm, s.mode[0].ticks,
+            s.mode[1].residency_ppm, s.mode[1].aligned, s.mode[1].ticks);
+    wake_align_set_enabled(!s.enabled);
+    k_work_schedule(&ab_work, K_SECONDS(CONFIG_WAKE_ALIGN_AB_PERIOD_S));
+}
+
+#endif
+
+
+static int wake_align_init(void)
+{
+    k_thread_runtime_stats_all_get(&checkpoint);
+#if CONFIG_WAKE_ALIGN_AB_PERIOD_S > 0
+    k_work_init_delayable(&ab_work, ab_handler);
+    k_work_schedule(&ab_work, K_SECONDS(CONFIG_WAKE_ALIGN_AB_PERIOD_S));
+#endif
+    return 0;
+}
+
+SYS_INIT(wake_align_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
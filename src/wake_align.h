@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 LooUQ Incorporated
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef WAKE_ALIGN_H_
+#define WAKE_ALIGN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+/* A wakeup the system takes anyway, that others may share */
+struct wake_source {
+    sys_snode_t node;
+    const char *name;
+    k_ticks_t period;           /* 0 = only the one at next */
+    k_ticks_t next;             /* absolute uptime ticks */
+};
+
+struct wake_align_mode_stats {
+    uint32_t ticks;             /* delays handed out */
+    uint32_t aligned;           /* ... that landed on a known wakeup */
+    uint32_t residency_ppm;     /* idle share of CPU time while in this mode */
+    uint64_t idle_cycles;
+    uint64_t all_cycles;
+};
+
+struct wake_align_stats {
+    bool enabled;
+    struct wake_align_mode_stats mode[2];      /* [0] free running, [1] aligned */
+};
+
+#if defined(CONFIG_WAKE_ALIGN)
+
+void wake_align_register(struct wake_source *src);
+
+/** Update a source's next wakeup (absolute uptime ticks), and optionally its period. */
+void wake_align_note(struct wake_source *src, k_ticks_t next, k_ticks_t period);
+
+/**
+ * Timeout for something due in delay_us that may run up to slack_ms late: the
+ * first known wakeup inside the window if there is one, else delay_us.
+ */
+k_timeout_t wake_align_delay(uint32_t delay_us, uint32_t slack_ms);
+
+void wake_align_set_enabled(bool enabled);
+
+void wake_align_stats_get(struct wake_align_stats *stats);
+
+#else
+
+static inline void wake_align_register(struct wake_source *src) { ARG_UNUSED(src); }
+static inline void wake_align_note(struct wake_source *src, k_ticks_t next, k_ticks_t period)
+{
+    ARG_UNUSED(src);
+    ARG_UNUSED(next);
+    ARG_UNUSED(period);
+}
+static inline k_timeout_t wake_align_delay(uint32_t delay_us, uint32_t slack_ms)
+{
+    ARG_UNUSED(slack_ms);
+    return K_USEC(delay_us);
+}
+
+#endif /* CONFIG_WAKE_ALIGN */
+
+#endif /* WAKE_ALIGN_H_ */